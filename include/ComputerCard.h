@@ -18,6 +18,15 @@ See examples/ directory
 #ifndef COMPUTERCARD_H
 #define COMPUTERCARD_H
 
+#ifdef TRACE_HOST_BUILD
+// Host-native builds (test/native) include this header only for the
+// RP2040 section-placement macros used throughout the oscillator code.
+// Turn them into no-ops and skip the hardware class entirely.
+#define __not_in_flash_func(func_name) func_name
+#define __scratch_x(group_name)
+#define __scratch_y(group_name)
+#else
+
 #include "hardware/gpio.h"
 #include "hardware/pwm.h"
 
@@ -30,6 +39,13 @@ See examples/ directory
 // USB host status pin
 #define USB_HOST_STATUS 20
 
+#define RUN_ADC_MODE_RUNNING 0
+#define RUN_ADC_MODE_REQUEST_ADC_STOP 1
+#define RUN_ADC_MODE_ADC_STOPPED 2
+#define RUN_ADC_MODE_REQUEST_ADC_RESTART 3
+#define RUN_ADC_MODE_REQUEST_ADC_PAUSE 4
+#define RUN_ADC_MODE_ADC_PAUSED 5
+
 class ComputerCard
 {
 	constexpr static int numLeds = 6;
@@ -69,6 +85,50 @@ protected:
 	/// Callback, called once per sample at 48kHz
 	virtual void ProcessSample() = 0;
 
+	/// Optional low-priority callback, called repeatedly from the main
+	/// loop while audio is running. Executes outside the audio interrupt,
+	/// so it is the place for LED refresh and other non-audio work.
+	virtual void Housekeeping() {}
+
+	/// Quiesce the ADC/DMA audio round and hold the outputs, e.g. so
+	/// flash can be written. Blocks until the audio interrupt has
+	/// acknowledged (at most one sample period). Call from Housekeeping,
+	/// never from ProcessSample, and resume with ResumeAudio().
+	void PauseAudio()
+	{
+		runADCMode = RUN_ADC_MODE_REQUEST_ADC_PAUSE;
+		while (runADCMode != RUN_ADC_MODE_ADC_PAUSED) {}
+	}
+
+	/// Restart audio after PauseAudio()
+	void ResumeAudio()
+	{
+		runADCMode = RUN_ADC_MODE_REQUEST_ADC_RESTART;
+	}
+
+#ifdef COMPUTERCARD_BLOCK_SIZE
+	/// Block callback, called once every COMPUTERCARD_BLOCK_SIZE samples
+	/// with that many input frames; fill outL/outR with output frames.
+	/// Output is played over the following block, so block mode adds
+	/// COMPUTERCARD_BLOCK_SIZE samples of latency. The sample ISR still
+	/// runs (the analogue mux and DMA must be advanced every sample) but
+	/// only moves one frame in and out; all DSP dispatch happens here,
+	/// once per block. The default implementation runs ProcessSample on
+	/// each frame, so existing cards behave identically apart from the
+	/// latency; cards overriding this can leave ProcessSample empty.
+	virtual void ProcessBlock(int16_t *inL, int16_t *inR, int16_t *outL, int16_t *outR, int n)
+	{
+		for (int i = 0; i < n; i++)
+		{
+			adcInL = inL[i];
+			adcInR = inR[i];
+			ProcessSample();
+			outL[i] = dacOut[0];
+			outR[i] = dacOut[1];
+		}
+	}
+#endif
+
 
 
 
@@ -310,6 +370,30 @@ protected:
 		return cvOutsCalibrated;
 	}
 
+	/// Average audio ISR load over the last ~0.1s, as percent of the
+	/// per-sample cycle budget at 48kHz
+	int32_t LoadPercent() const { return loadPercentVal; }
+
+	/// Worst single-sample ISR cost since ResetLoadStats(), percent of budget
+	int32_t PeakLoadPercent() const
+	{
+		return cyclesPerSample ? (int32_t)((peakCycles * 100) / cyclesPerSample) : 0;
+	}
+
+	/// Cycles spent servicing the most recent audio interrupt.
+	/// Sampled per interrupt, so card code can tag it per oscillator.
+	uint32_t LastSampleCycles() const { return lastSampleCycles; }
+
+	/// Number of samples that overran the per-sample cycle budget
+	uint32_t DeadlineMisses() const { return deadlineMisses; }
+
+	/// Clear peak and deadline-miss statistics
+	void ResetLoadStats()
+	{
+		peakCycles = 0;
+		deadlineMisses = 0;
+	}
+
 	
 	void Abort();
 
@@ -351,6 +435,15 @@ private:
 	HardwareVersion_t ProbeHardwareVersion();
 	
 	int16_t dacOut[2];
+
+#ifdef COMPUTERCARD_BLOCK_SIZE
+	// Block-mode frame buffers: input accumulates into blockIn while
+	// blockOut plays back, both swapped by ProcessBlock every
+	// COMPUTERCARD_BLOCK_SIZE samples
+	int16_t blockInL[COMPUTERCARD_BLOCK_SIZE], blockInR[COMPUTERCARD_BLOCK_SIZE];
+	int16_t blockOutL[COMPUTERCARD_BLOCK_SIZE] = {0}, blockOutR[COMPUTERCARD_BLOCK_SIZE] = {0};
+	int blockIndex = 0;
+#endif
 	
 	volatile int32_t knobs[4] = { 0, 0, 0, 0 }; // 0-4095
 	volatile bool pulse[2] = { 0, 0 };
@@ -380,6 +473,16 @@ private:
 
 	uint8_t dmaPhase = 0;
 
+	// ISR load instrumentation, measured with the SysTick cycle counter
+	static constexpr uint32_t loadWindow = 4800; // ~0.1s at 48kHz
+	uint32_t cyclesPerSample = 0;
+	volatile uint32_t loadAcc = 0;
+	volatile uint32_t loadWindowCount = 0;
+	volatile uint32_t loadPercentVal = 0;
+	volatile uint32_t peakCycles = 0;
+	volatile uint32_t deadlineMisses = 0;
+	volatile uint32_t lastSampleCycles = 0;
+
 	// Convert signed int16 value into data string for DAC output
 	uint16_t __not_in_flash_func(dacval)(int16_t value, uint16_t dacChannel)
 	{
@@ -391,7 +494,12 @@ private:
 
 	
     void CorrectADCDNL(uint16_t &value) const;
-	
+
+	// DNL correction folded into a lookup table, built at startup by
+	// running CorrectADCDNL over every code: one load per reading in
+	// the ISR instead of the branch and multiply chain. 8KB.
+	static uint16_t dnlTab[4096];
+
 	void BufferFull();
 
 	void AudioWorker();
@@ -429,6 +537,7 @@ private:
 #include "hardware/i2c.h"
 #include "hardware/irq.h"
 #include "hardware/spi.h"
+#include "hardware/structs/systick.h"
 
 // Input normalisation probe pin
 #define NORMALISATION_PROBE 4
@@ -468,10 +577,6 @@ private:
 #define BOARD_ID_2 5
 
 // The ADC (/DMA) run mode, used to stop DMA in a known state before writing to flash
-#define RUN_ADC_MODE_RUNNING 0
-#define RUN_ADC_MODE_REQUEST_ADC_STOP 1
-#define RUN_ADC_MODE_ADC_STOPPED 2
-#define RUN_ADC_MODE_REQUEST_ADC_RESTART 3
 
 
 #define EEPROM_ADDR_ID 0
@@ -489,6 +594,7 @@ volatile uint32_t ComputerCard::cvValue[2] = {262144,262144};
 
 
 ComputerCard *ComputerCard::thisptr;
+uint16_t ComputerCard::dnlTab[4096];
 
 // Return pseudo-random bit for normalisation probe
 uint32_t __not_in_flash_func(ComputerCard::next_norm_probe)()
@@ -501,6 +607,12 @@ uint32_t __not_in_flash_func(ComputerCard::next_norm_probe)()
 // Main audio core function
 void __not_in_flash_func(ComputerCard::AudioWorker)()
 {
+	// Start the SysTick cycle counter (24-bit, core clock) for ISR load
+	// measurement, and work out the cycle budget of one audio sample
+	cyclesPerSample = clock_get_hz(clk_sys) / 48000;
+	systick_hw->rvr = 0x00FFFFFF;
+	systick_hw->cvr = 0;
+	systick_hw->csr = 0x5; // enable, processor clock
 
 	adc_select_input(0);
 	adc_set_round_robin(0b0001111U);
@@ -587,6 +699,10 @@ void __not_in_flash_func(ComputerCard::AudioWorker)()
 			irq_remove_handler(PWM_IRQ_WRAP, ComputerCard::OnCVPWMWrap);
 			break;
 		}
+		else if (runADCMode == RUN_ADC_MODE_RUNNING)
+		{
+			Housekeeping();
+		}
 		   
 
 	}
@@ -608,6 +724,8 @@ void __not_in_flash_func(ComputerCard::CorrectADCDNL)(uint16_t &value) const
 // Per-audio-sample ISR, called when two sets of ADC samples have been collected from all four inputs
 void __not_in_flash_func(ComputerCard::BufferFull)()
 {
+	uint32_t t_entry = systick_hw->cvr;
+
 	static int startupCounter = 8; // Decreases by 1 each sample, can do startup things when nonzero.
 	static int mux_state = 0;
 	static int norm_probe_count = 0;
@@ -638,22 +756,27 @@ void __not_in_flash_func(ComputerCard::BufferFull)()
 	// Set CV inputs, with ~240Hz LPF on CV input
 	int cvi = mux_state % 2;
 
-	// Compensation of ADC DNL errors.
-	CorrectADCDNL(ADC_Buffer[cpuPhase][7]); // CV inputs
-	CorrectADCDNL(ADC_Buffer[cpuPhase][0]); // Audio inputs
-	CorrectADCDNL(ADC_Buffer[cpuPhase][4]);
-	CorrectADCDNL(ADC_Buffer[cpuPhase][1]);
-	CorrectADCDNL(ADC_Buffer[cpuPhase][5]);
-	
-	cvsm[cvi] = (15 * (cvsm[cvi]) + 16 * ADC_Buffer[cpuPhase][7]) >> 4;
+	// Compensation of ADC DNL errors, one table load per reading.
+	// Condition the fixed buffer layout into locals in one go, so the
+	// code below works on registers instead of re-reading the DMA
+	// buffer. The mux pin (entry 6) was never corrected.
+	const uint16_t *adcBuf = ADC_Buffer[cpuPhase];
+	int32_t audR1 = dnlTab[adcBuf[0] & 0xFFF]; // Audio inputs, two samples each
+	int32_t audL1 = dnlTab[adcBuf[1] & 0xFFF];
+	int32_t audR2 = dnlTab[adcBuf[4] & 0xFFF];
+	int32_t audL2 = dnlTab[adcBuf[5] & 0xFFF];
+	int32_t knobRaw = adcBuf[6];               // multiplexed knobs
+	int32_t cvRaw = dnlTab[adcBuf[7] & 0xFFF]; // CV inputs
+
+	cvsm[cvi] = (15 * (cvsm[cvi]) + 16 * cvRaw) >> 4;
 	cv[cvi] = 2048 - (cvsm[cvi] >> 4);
 
 
 	// Set audio inputs, by averaging the two samples collected.
 	// Invert to counteract inverting op-amp input configuration
-	adcInR = -(((ADC_Buffer[cpuPhase][0] + ADC_Buffer[cpuPhase][4]) - 0x1000) >> 1);
+	adcInR = -(((audR1 + audR2) - 0x1000) >> 1);
 
-	adcInL = -(((ADC_Buffer[cpuPhase][1] + ADC_Buffer[cpuPhase][5]) - 0x1000) >> 1);
+	adcInL = -(((audL1 + audL2) - 0x1000) >> 1);
 
 	// Set pulse inputs
 	last_pulse[0] = pulse[0];
@@ -663,7 +786,7 @@ void __not_in_flash_func(ComputerCard::BufferFull)()
 
 	// Set knobs, with ~60Hz LPF
 	int knob = mux_state;
-	knobssm[knob] = (127 * (knobssm[knob]) + 16 * ADC_Buffer[cpuPhase][6]) >> 7;
+	knobssm[knob] = (127 * (knobssm[knob]) + 16 * knobRaw) >> 7;
 	knobs[knob] = knobssm[knob] >> 4;
 
 	// Set switch value
@@ -692,14 +815,14 @@ void __not_in_flash_func(ComputerCard::BufferFull)()
 		// CV sampled at 24kHz comes in over two successive samples
 		if (norm_probe_count == 14 || norm_probe_count == 15)
 		{
-			plug_state[2+cvi] = (plug_state[2+cvi]<<1)+(ADC_Buffer[cpuPhase][7]<1800);
+			plug_state[2+cvi] = (plug_state[2+cvi]<<1)+(cvRaw<1800);
 		}
 
 		// Audio and pulse measured every sample at 48kHz
 		if (norm_probe_count == 15)
 		{
-			plug_state[Input::Audio1] = (plug_state[Input::Audio1]<<1)+(ADC_Buffer[cpuPhase][5]<1800);
-			plug_state[Input::Audio2] = (plug_state[Input::Audio2]<<1)+(ADC_Buffer[cpuPhase][4]<1800);
+			plug_state[Input::Audio1] = (plug_state[Input::Audio1]<<1)+(audL2<1800);
+			plug_state[Input::Audio2] = (plug_state[Input::Audio2]<<1)+(audR2<1800);
 			plug_state[Input::Pulse1] = (plug_state[Input::Pulse1]<<1)+(pulse[0]);
 			plug_state[Input::Pulse2] = (plug_state[Input::Pulse2]<<1)+(pulse[1]);
 
@@ -720,7 +843,21 @@ void __not_in_flash_func(ComputerCard::BufferFull)()
 	
 	////////////////////////////////////////
 	// Run the DSP
+#ifdef COMPUTERCARD_BLOCK_SIZE
+	// Move one frame in and out; dispatch the DSP once per block
+	blockInL[blockIndex] = adcInL;
+	blockInR[blockIndex] = adcInR;
+	dacOut[0] = blockOutL[blockIndex];
+	dacOut[1] = blockOutR[blockIndex];
+	blockIndex++;
+	if (blockIndex == COMPUTERCARD_BLOCK_SIZE)
+	{
+		blockIndex = 0;
+		ProcessBlock(blockInL, blockInR, blockOutL, blockOutR, COMPUTERCARD_BLOCK_SIZE);
+	}
+#else
 	ProcessSample();
+#endif
 
 	////////////////////////////////////////
 	// Collect DSP outputs and put them in the DAC SPI buffer
@@ -732,6 +869,21 @@ void __not_in_flash_func(ComputerCard::BufferFull)()
 
 	mux_state = next_mux_state;
 
+	// If PauseAudio called, stop the ADC round but keep the DMA channel
+	// configuration, so the restart request can re-trigger them
+	if (runADCMode == RUN_ADC_MODE_REQUEST_ADC_PAUSE)
+	{
+		adc_run(false);
+		adc_set_round_robin(0);
+		adc_select_input(0);
+
+		dma_hw->ints0 = 1u << adc_dma; // reset adc interrupt flag
+		dma_channel_abort(adc_dma);
+		dma_channel_abort(spi_dma);
+
+		runADCMode = RUN_ADC_MODE_ADC_PAUSED;
+	}
+
 	// If Abort called, stop ADC and DMA
 	if (runADCMode == RUN_ADC_MODE_REQUEST_ADC_STOP)
 	{
@@ -755,6 +907,26 @@ void __not_in_flash_func(ComputerCard::BufferFull)()
 	lastSwitchVal = switchVal;
 	
 	if (startupCounter) startupCounter--;
+
+	// SysTick counts down; elapsed wraps correctly in 24 bits
+	uint32_t elapsed = (t_entry - systick_hw->cvr) & 0x00FFFFFF;
+	lastSampleCycles = elapsed;
+	if (elapsed > peakCycles) peakCycles = elapsed;
+#ifdef COMPUTERCARD_BLOCK_SIZE
+	// Block-boundary samples carry a whole block of DSP; their budget is
+	// a block of sample periods (output is buffered a block ahead)
+	if (elapsed > cyclesPerSample * COMPUTERCARD_BLOCK_SIZE) deadlineMisses = deadlineMisses + 1;
+#else
+	if (elapsed > cyclesPerSample) deadlineMisses = deadlineMisses + 1;
+#endif
+	loadAcc = loadAcc + elapsed;
+	loadWindowCount = loadWindowCount + 1;
+	if (loadWindowCount >= loadWindow)
+	{
+		loadPercentVal = loadAcc / ((loadWindow * cyclesPerSample) / 100);
+		loadAcc = 0;
+		loadWindowCount = 0;
+	}
 }
 
 ComputerCard::HardwareVersion_t ComputerCard::ProbeHardwareVersion()
@@ -800,6 +972,14 @@ ComputerCard::ComputerCard()
 {
 	runADCMode = RUN_ADC_MODE_RUNNING;
 
+	// Tabulate the ADC DNL correction for the ISR
+	for (uint32_t i = 0; i < 4096; i++)
+	{
+		uint16_t v = i;
+		CorrectADCDNL(v);
+		dnlTab[i] = v;
+	}
+
 	adc_run(false);
 	adc_select_input(0);
 
@@ -1135,4 +1315,6 @@ uint32_t ComputerCard::MillivoltsToDAC(int millivolts, int channel, bool &limite
 
 #endif
 
+#endif // TRACE_HOST_BUILD
+
 #endif
@@ -0,0 +1,159 @@
+#pragma once
+
+#include "ComputerCard.h"
+#include <cstdint>
+#include <cstring>
+#include "table_ram.h"
+#include "mesh_data.h"
+
+#ifndef TRACE_HOST_BUILD
+#include "hardware/dma.h"
+#include "hardware/flash.h"
+#endif
+
+// Shape bank registry in a reserved flash region.
+//
+// Adding a shape used to mean pasting arrays into lookup_tables.h /
+// mesh_data.h and rebuilding. The registry instead reads a binary image
+// that util/bank_pack.py builds and picotool writes into the last part
+// of flash, well clear of the firmware:
+//
+//   Header:  uint32 magic 'TRBK', uint16 version, uint16 entry count
+//   Entry[]: uint16 type, uint16 flags, uint32 offset, uint32 bytes,
+//            uint32 count   (offset relative to the region start)
+//
+// Payload types: a raw stereo wavetable (1024 left then 1024 right
+// int16s, mip levels built on load like the built-in tables) or a
+// delta-encoded mesh stream (DeltaMeshPath format). Stereo tables are
+// copied into a RAM slot on selection -- by DMA on the device, so the
+// core is free during the ~4KB transfer -- while delta meshes decode
+// sequentially and can play straight from flash.
+namespace BankRegistry
+{
+    constexpr uint32_t MAGIC = 0x4B425254; // "TRBK"
+    constexpr uint16_t VERSION = 1;
+
+// Region start, relative to the beginning of flash. The default leaves
+// the last 512KB of the 2MB part for shape data.
+#ifndef TRACE_BANK_FLASH_OFFSET
+#define TRACE_BANK_FLASH_OFFSET 0x180000
+#endif
+
+    enum EntryType : uint16_t
+    {
+        StereoTableType = 0, // 2048 int16: 1024 left, 1024 right
+        DeltaPathType = 1,   // delta-encoded Point3D stream
+    };
+
+    struct Entry
+    {
+        uint16_t type;
+        uint16_t flags;
+        uint32_t offset;
+        uint32_t bytes;
+        uint32_t count; // points for DeltaPathType, unused for tables
+    };
+
+    struct Header
+    {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t count;
+    };
+
+#ifdef TRACE_HOST_BUILD
+    // Host tests hand the registry an in-memory image
+    inline const uint8_t *base = nullptr;
+    inline void SetBase(const uint8_t *b) { base = b; }
+#else
+    inline const uint8_t *const base =
+        (const uint8_t *)(XIP_BASE + TRACE_BANK_FLASH_OFFSET);
+#endif
+
+    inline const Header *header() { return (const Header *)base; }
+    inline const Entry *entries() { return (const Entry *)(base + sizeof(Header)); }
+
+    inline bool Valid()
+    {
+        return base != nullptr && header()->magic == MAGIC &&
+               header()->version == VERSION;
+    }
+
+    inline int Count() { return Valid() ? header()->count : 0; }
+
+    inline const Entry *Get(int i)
+    {
+        return (i >= 0 && i < Count()) ? &entries()[i] : nullptr;
+    }
+
+    inline const uint8_t *Payload(const Entry &e) { return base + e.offset; }
+
+    // Word copy out of flash. On the device this goes through a DMA
+    // channel so the core only pays the setup cost; the host fallback
+    // is a memcpy.
+    inline void CopyFromFlash(void *dst, const void *src, uint32_t bytes)
+    {
+#ifndef TRACE_HOST_BUILD
+        if ((bytes & 3) == 0)
+        {
+            int ch = dma_claim_unused_channel(true);
+            dma_channel_config cfg = dma_channel_get_default_config(ch);
+            channel_config_set_transfer_data_size(&cfg, DMA_SIZE_32);
+            channel_config_set_read_increment(&cfg, true);
+            channel_config_set_write_increment(&cfg, true);
+            dma_channel_configure(ch, &cfg, dst, src, bytes >> 2, true);
+            dma_channel_wait_for_finish_blocking(ch);
+            dma_channel_unclaim(ch);
+            return;
+        }
+#endif
+        memcpy(dst, src, bytes);
+    }
+
+    // Copy a stereo table entry into a RAM mip slot and build the
+    // reduced levels, same derivation as the built-in tables
+    inline bool LoadStereo(const Entry &e, StereoTableMip &dst)
+    {
+        if (e.type != StereoTableType || e.bytes != 2048 * sizeof(int16_t))
+            return false;
+        const int16_t *src = (const int16_t *)Payload(e);
+        CopyFromFlash(dst.left, src, 1024 * sizeof(int16_t));
+        CopyFromFlash(dst.right, src + 1024, 1024 * sizeof(int16_t));
+        for (int lvl = 1; lvl < StereoTableMip::levels; lvl++)
+        {
+            int n = 1024 >> lvl;
+            TableRam::DecimateLevel(dst.Left(lvl - 1), dst.left + StereoTableMip::offsets[lvl], n);
+            TableRam::DecimateLevel(dst.Right(lvl - 1), dst.right + StereoTableMip::offsets[lvl], n);
+        }
+        return true;
+    }
+
+    // View a delta mesh entry in place; the stream stays in flash.
+    // The count ceiling matches the DeltaMesh checkpoint array (64
+    // checkpoints of 64 points); a corrupt entry past it would
+    // overflow the decoder's state.
+    inline bool GetDeltaPath(const Entry &e, DeltaMeshPath &out)
+    {
+        if (e.type != DeltaPathType || e.count < 2 || e.count > 4096)
+            return false;
+        out.data = Payload(e);
+        out.count = e.count;
+        return true;
+    }
+
+    // Load the n'th stereo table in the registry (0-based), skipping
+    // entries of other types
+    inline bool LoadNthStereo(int n, StereoTableMip &dst)
+    {
+        for (int i = 0; i < Count(); i++)
+            if (entries()[i].type == StereoTableType && n-- == 0)
+                return LoadStereo(entries()[i], dst);
+        return false;
+    }
+
+    // Convenience for boot: load the first stereo table in the registry
+    inline bool LoadFirstStereo(StereoTableMip &dst)
+    {
+        return LoadNthStereo(0, dst);
+    }
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "ComputerCard.h"
+#include <cstdint>
+
+// Branchless saturating fixed-point helpers.
+//
+// The Cortex-M0+ has no conditional-select instruction, so the ternary
+// clamps that used to open every compute() turn into unpredictable
+// branches in the per-sample paths. These helpers use the
+// sign-extension idiom (v >> 31 is all ones for negative v), which GCC
+// compiles to short branch-free ASR/AND/ADD sequences.
+//
+// MulHi replaces the (uint64_t)a * b >> 32 idiom: the M0+ multiplier
+// is 32x32->32 only, so the 64-bit form calls out to libgcc; four
+// 16x16 partial products stay on single-cycle MULS and produce the
+// identical result.
+namespace FixedPoint
+{
+    // max(v, 0)
+    inline int32_t __not_in_flash_func(ClampPos)(int32_t v)
+    {
+        return v & ~(v >> 31);
+    }
+
+    // Clamp to [lo, hi] (lo <= hi). v - lo must not underflow int32,
+    // which holds for all the control ranges passed in here.
+    inline int32_t __not_in_flash_func(Clamp)(int32_t v, int32_t lo, int32_t hi)
+    {
+        v -= lo;
+        v &= ~(v >> 31);
+        v -= hi - lo;
+        v &= v >> 31;
+        return v + hi;
+    }
+
+    // Clamp to the signed 12-bit audio/DAC range
+    inline int32_t __not_in_flash_func(SatAudio)(int32_t v)
+    {
+        return Clamp(v, -2048, 2047);
+    }
+
+    // Saturating add in the audio range
+    inline int32_t __not_in_flash_func(SatAdd)(int32_t a, int32_t b)
+    {
+        return SatAudio(a + b);
+    }
+
+    // Q12 / Q15 multiplies, truncating like the idioms they replace
+    inline int32_t __not_in_flash_func(MulQ12)(int32_t a, int32_t b)
+    {
+        return (a * b) >> 12;
+    }
+
+    inline int32_t __not_in_flash_func(MulQ15)(int32_t a, int32_t b)
+    {
+        return (a * b) >> 15;
+    }
+
+    // High word of an unsigned 32x32 multiply
+    inline uint32_t __not_in_flash_func(MulHi)(uint32_t a, uint32_t b)
+    {
+        uint32_t al = a & 0xFFFF, ah = a >> 16;
+        uint32_t bl = b & 0xFFFF, bh = b >> 16;
+        uint32_t m = al * bh + ((al * bl) >> 16);
+        uint32_t n = ah * bl + (m & 0xFFFF);
+        return ah * bh + (m >> 16) + (n >> 16);
+    }
+
+    // Signed high word, corrected from the unsigned one
+    inline int32_t __not_in_flash_func(MulHiS)(int32_t a, int32_t b)
+    {
+        return (int32_t)(MulHi((uint32_t)a, (uint32_t)b) -
+                         ((uint32_t)b & (uint32_t)(a >> 31)) -
+                         ((uint32_t)a & (uint32_t)(b >> 31)));
+    }
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "ComputerCard.h"
+#include <cstdint>
+
+// Polyphase half-band decimator (2:1).
+//
+// 7-tap half-band lowpass with Q15 taps [-0.03125, 0, 0.28125, 0.5,
+// 0.28125, 0, -0.03125]. Every odd tap except the centre is zero, so
+// the polyphase form costs only two multiplies and a shift per output
+// sample: the even-phase branch runs the short symmetric FIR and the
+// odd-phase branch is just the delayed centre tap. Cascade two of
+// these for 4x oversampling.
+class HalfBandDecimator
+{
+    // Q15 coefficients of the even-phase branch
+    static constexpr int32_t C_OUTER = -1024; // -0.03125
+    static constexpr int32_t C_INNER = 9216;  //  0.28125
+
+    // even-phase delay line, newest first
+    int32_t e0 = 0, e1 = 0, e2 = 0, e3 = 0;
+    // odd-phase (centre tap) delay
+    int32_t o0 = 0, o1 = 0;
+
+public:
+    // Consume two input samples at the high rate, produce one output
+    int32_t __not_in_flash_func(Process)(int32_t in0, int32_t in1)
+    {
+        e3 = e2;
+        e2 = e1;
+        e1 = e0;
+        e0 = in0;
+        o1 = o0;
+        o0 = in1;
+
+        return ((C_OUTER * (e0 + e3) + C_INNER * (e1 + e2)) >> 15) + (o1 >> 1);
+    }
+
+    void Reset()
+    {
+        e0 = e1 = e2 = e3 = 0;
+        o0 = o1 = 0;
+    }
+};
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "ComputerCard.h"
+#include <cstdint>
+
+// Table interpolation backend on the RP2040 interp peripheral.
+//
+// interp0 in blend mode computes base0 + (base1 - base0) * alpha/256 in
+// a single cycle, so the fractional blend in sine() and the wavetable
+// lookups becomes three MMIO stores and one load instead of two 32-bit
+// multiplies. The peripheral is per-core; Setup() must run once per
+// block on whichever core renders (RenderBlock does this), which also
+// reclaims the lanes from anything else that used them.
+//
+// Define TRACE_NO_HW_INTERP to keep the software blend (also used for
+// host builds, where no peripheral exists). The software path keeps the
+// full 16-bit fraction; hardware blends with the top 8 bits.
+
+#if !defined(TRACE_NO_HW_INTERP) && !defined(TRACE_HOST_BUILD)
+#include "hardware/interp.h"
+#endif
+
+namespace InterpLerp
+{
+#if !defined(TRACE_NO_HW_INTERP) && !defined(TRACE_HOST_BUILD)
+    inline void __not_in_flash_func(Setup)()
+    {
+        interp_config cfg = interp_default_config();
+        interp_config_set_blend(&cfg, true);
+        interp_set_config(interp0, 0, &cfg);
+
+        cfg = interp_default_config();
+        interp_config_set_signed(&cfg, true);
+        interp_set_config(interp0, 1, &cfg);
+    }
+
+    // Blend s1 towards s2 by a 16-bit fraction
+    inline int32_t __not_in_flash_func(Blend)(int32_t s1, int32_t s2, uint32_t frac16)
+    {
+        interp0->base[0] = (uint32_t)s1;
+        interp0->base[1] = (uint32_t)s2;
+        interp0->accum[1] = frac16 >> 8;
+        return (int32_t)interp0->peek[1];
+    }
+#else
+    inline void Setup() {}
+
+    inline int32_t __not_in_flash_func(Blend)(int32_t s1, int32_t s2, uint32_t frac16)
+    {
+        return (s2 * (int32_t)frac16 + s1 * (int32_t)(65536 - frac16)) >> 16;
+    }
+#endif
+}
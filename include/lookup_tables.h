@@ -1,73 +1,106 @@
 #pragma once
 #include <cstdint>
 
-constexpr int32_t SINE_TABLE[512] = {
-    0, 392, 785, 1177, 1570, 1962, 2354, 2745,
-    3136, 3527, 3917, 4306, 4695, 5083, 5470, 5857,
-    6242, 6627, 7011, 7393, 7775, 8155, 8534, 8912,
-    9289, 9664, 10037, 10409, 10780, 11149, 11516, 11882,
-    12245, 12607, 12967, 13325, 13681, 14035, 14387, 14737,
-    15084, 15429, 15772, 16113, 16451, 16786, 17119, 17450,
-    17778, 18103, 18425, 18745, 19062, 19376, 19687, 19995,
-    20300, 20602, 20901, 21197, 21489, 21779, 22065, 22348,
-    22627, 22903, 23175, 23444, 23710, 23972, 24230, 24485,
-    24736, 24983, 25227, 25466, 25702, 25934, 26162, 26386,
-    26607, 26823, 27035, 27243, 27447, 27647, 27842, 28034,
-    28221, 28404, 28583, 28757, 28927, 29093, 29254, 29411,
-    29564, 29712, 29855, 29994, 30129, 30259, 30384, 30505,
-    30622, 30733, 30840, 30943, 31041, 31134, 31222, 31306,
-    31385, 31459, 31528, 31593, 31653, 31708, 31759, 31805,
-    31845, 31882, 31913, 31939, 31961, 31978, 31990, 31997,
-    32000, 31997, 31990, 31978, 31961, 31939, 31913, 31882,
-    31845, 31805, 31759, 31708, 31653, 31593, 31528, 31459,
-    31385, 31306, 31222, 31134, 31041, 30943, 30840, 30733,
-    30622, 30505, 30384, 30259, 30129, 29994, 29855, 29712,
-    29564, 29411, 29254, 29093, 28927, 28757, 28583, 28404,
-    28221, 28034, 27842, 27647, 27447, 27243, 27035, 26823,
-    26607, 26386, 26162, 25934, 25702, 25466, 25227, 24983,
-    24736, 24485, 24230, 23972, 23710, 23444, 23175, 22903,
-    22627, 22348, 22065, 21779, 21489, 21197, 20901, 20602,
-    20300, 19995, 19687, 19376, 19062, 18745, 18425, 18103,
-    17778, 17450, 17119, 16786, 16451, 16113, 15772, 15429,
-    15084, 14737, 14387, 14035, 13681, 13325, 12967, 12607,
-    12245, 11882, 11516, 11149, 10780, 10409, 10037, 9664,
-    9289, 8912, 8534, 8155, 7775, 7393, 7011, 6627,
-    6242, 5857, 5470, 5083, 4695, 4306, 3917, 3527,
-    3136, 2745, 2354, 1962, 1570, 1177, 785, 392,
-    0, -392, -785, -1177, -1570, -1962, -2354, -2745,
-    -3136, -3527, -3917, -4306, -4695, -5083, -5470, -5857,
-    -6242, -6627, -7011, -7393, -7775, -8155, -8534, -8912,
-    -9289, -9664, -10037, -10409, -10780, -11149, -11516, -11882,
-    -12245, -12607, -12967, -13325, -13681, -14035, -14387, -14737,
-    -15084, -15429, -15772, -16113, -16451, -16786, -17119, -17450,
-    -17778, -18103, -18425, -18745, -19062, -19376, -19687, -19995,
-    -20300, -20602, -20901, -21197, -21489, -21779, -22065, -22348,
-    -22627, -22903, -23175, -23444, -23710, -23972, -24230, -24485,
-    -24736, -24983, -25227, -25466, -25702, -25934, -26162, -26386,
-    -26607, -26823, -27035, -27243, -27447, -27647, -27842, -28034,
-    -28221, -28404, -28583, -28757, -28927, -29093, -29254, -29411,
-    -29564, -29712, -29855, -29994, -30129, -30259, -30384, -30505,
-    -30622, -30733, -30840, -30943, -31041, -31134, -31222, -31306,
-    -31385, -31459, -31528, -31593, -31653, -31708, -31759, -31805,
-    -31845, -31882, -31913, -31939, -31961, -31978, -31990, -31997,
-    -32000, -31997, -31990, -31978, -31961, -31939, -31913, -31882,
-    -31845, -31805, -31759, -31708, -31653, -31593, -31528, -31459,
-    -31385, -31306, -31222, -31134, -31041, -30943, -30840, -30733,
-    -30622, -30505, -30384, -30259, -30129, -29994, -29855, -29712,
-    -29564, -29411, -29254, -29093, -28927, -28757, -28583, -28404,
-    -28221, -28034, -27842, -27647, -27447, -27243, -27035, -26823,
-    -26607, -26386, -26162, -25934, -25702, -25466, -25227, -24983,
-    -24736, -24485, -24230, -23972, -23710, -23444, -23175, -22903,
-    -22627, -22348, -22065, -21779, -21489, -21197, -20901, -20602,
-    -20300, -19995, -19687, -19376, -19062, -18745, -18425, -18103,
-    -17778, -17450, -17119, -16786, -16451, -16113, -15772, -15429,
-    -15084, -14737, -14387, -14035, -13681, -13325, -12967, -12607,
-    -12245, -11882, -11516, -11149, -10780, -10409, -10037, -9664,
-    -9289, -8912, -8534, -8155, -7775, -7393, -7011, -6627,
-    -6242, -5857, -5470, -5083, -4695, -4306, -3917, -3527,
-    -3136, -2745, -2354, -1962, -1570, -1177, -785, -392
+// Lookup tables.
+//
+// The sine table is analytically derivable, so it is generated at
+// compile time below instead of being pasted in as 512 literals; the
+// wavetables come from sampled SVG paths (util/wavtable_prep.py) and
+// stay literal. Generated tables cost no flash beyond their data and
+// can be resized per-build without re-running Python.
 
-};
+namespace tablegen
+{
+    constexpr double PI = 3.14159265358979323846;
+
+    // Taylor series on |x| <= pi/4, accurate to ~1 double ulp
+    constexpr double sinPoly(double x)
+    {
+        double x2 = x * x, term = x, sum = x;
+        for (int k = 3; k <= 17; k += 2)
+        {
+            term *= -x2 / (k * (k - 1));
+            sum += term;
+        }
+        return sum;
+    }
+
+    constexpr double cosPoly(double x)
+    {
+        double x2 = x * x, term = 1.0, sum = 1.0;
+        for (int k = 2; k <= 18; k += 2)
+        {
+            term *= -x2 / (k * (k - 1));
+            sum += term;
+        }
+        return sum;
+    }
+
+    // sin(pi * i / 256) for i in [0, 128], exact at the quadrant ends
+    constexpr double sinQuadrant(int i)
+    {
+        return i <= 64 ? sinPoly(PI * i / 256)
+                       : cosPoly(PI * (128 - i) / 256);
+    }
+
+    struct SineTable
+    {
+        int32_t v[512];
+    };
+
+    // One period, amplitude 32000, truncated toward zero: identical to
+    // the old Python-generated table (int(sin(2*pi*i/512) * 32000))
+    constexpr SineTable makeSineTable()
+    {
+        SineTable t{};
+        for (int i = 0; i <= 128; i++)
+        {
+            int32_t s = (int32_t)(sinQuadrant(i) * 32000.0);
+            t.v[i] = s;
+            t.v[256 - i] = s;
+            if (i > 0)
+            {
+                t.v[256 + i] = -s;
+                t.v[(512 - i) & 511] = -s;
+            }
+        }
+        return t;
+    }
+
+    inline constexpr SineTable SINE = makeSineTable();
+
+    // polyBLEP / polyBLAMP residuals: (1-u)^2 and (1-u)^3 in Q15 for
+    // u in [0,1], 64 intervals plus a guard entry for interpolation.
+    // Linear interpolation of these low-order polynomials stays well
+    // below one output LSB. Capped at 32767: like the sine table, these
+    // go through InterpLerp::Blend, whose lanes are signed 16-bit.
+    struct ResidualTable
+    {
+        int32_t v[65];
+    };
+
+    constexpr ResidualTable makeResidualTable(int power)
+    {
+        ResidualTable t{};
+        for (int i = 0; i <= 64; i++)
+        {
+            double r = 1.0 - i / 64.0;
+            double p = r;
+            for (int k = 1; k < power; k++)
+                p *= r;
+            int32_t q = (int32_t)(p * 32768.0 + 0.5);
+            t.v[i] = q > 32767 ? 32767 : q;
+        }
+        return t;
+    }
+
+    inline constexpr ResidualTable BLEP = makeResidualTable(2);
+    inline constexpr ResidualTable BLAMP = makeResidualTable(3);
+}
+
+inline constexpr auto &SINE_TABLE = tablegen::SINE.v;
+inline constexpr auto &BLEP_TABLE = tablegen::BLEP.v;
+inline constexpr auto &BLAMP_TABLE = tablegen::BLAMP.v;
 
 // Stereo avetable definition
 struct StereoTable
@@ -593,521 +626,6 @@ inline constexpr StereoTable YANG_TABLE = {
      20252, 20843, 20209, 20892, 20153, 20959, 20074, 21054,
      19956, 21203, 19761, 21470, 19376, 22076, 18279, 24683}};
 
-inline constexpr int32_t FREQ_INC_LUT_EXP[4096] = {
-894784, 895694, 896604, 897515, 898427, 899340, 900253, 901168,
-902084, 903001, 903918, 904837, 905756, 906676, 907598, 908520,
-909443, 910367, 911292, 912218, 913145, 914073, 915002, 915931,
-916862, 917794, 918726, 919660, 920594, 921530, 922466, 923404,
-924342, 925281, 926221, 927162, 928105, 929048, 929992, 930937,
-931883, 932829, 933777, 934726, 935676, 936627, 937578, 938531,
-939485, 940439, 941395, 942352, 943309, 944268, 945227, 946188,
-947149, 948111, 949075, 950039, 951004, 951971, 952938, 953906,
-954876, 955846, 956817, 957789, 958763, 959737, 960712, 961688,
-962666, 963644, 964623, 965603, 966584, 967566, 968550, 969534,
-970519, 971505, 972492, 973480, 974469, 975460, 976451, 977443,
-978436, 979430, 980426, 981422, 982419, 983417, 984417, 985417,
-986418, 987421, 988424, 989428, 990434, 991440, 992447, 993456,
-994465, 995476, 996487, 997500, 998513, 999528, 1000544, 1001560,
-1002578, 1003597, 1004617, 1005637, 1006659, 1007682, 1008706, 1009731,
-1010757, 1011784, 1012812, 1013841, 1014871, 1015903, 1016935, 1017968,
-1019003, 1020038, 1021075, 1022112, 1023151, 1024190, 1025231, 1026273,
-1027316, 1028359, 1029404, 1030450, 1031497, 1032546, 1033595, 1034645,
-1035696, 1036749, 1037802, 1038857, 1039912, 1040969, 1042027, 1043086,
-1044145, 1045206, 1046268, 1047332, 1048396, 1049461, 1050527, 1051595,
-1052663, 1053733, 1054804, 1055876, 1056949, 1058022, 1059098, 1060174,
-1061251, 1062329, 1063409, 1064489, 1065571, 1066654, 1067738, 1068823,
-1069909, 1070996, 1072084, 1073173, 1074264, 1075355, 1076448, 1077542,
-1078637, 1079733, 1080830, 1081928, 1083028, 1084128, 1085230, 1086332,
-1087436, 1088541, 1089647, 1090754, 1091863, 1092972, 1094083, 1095195,
-1096307, 1097421, 1098536, 1099653, 1100770, 1101889, 1103008, 1104129,
-1105251, 1106374, 1107498, 1108624, 1109750, 1110878, 1112006, 1113136,
-1114267, 1115400, 1116533, 1117668, 1118803, 1119940, 1121078, 1122217,
-1123358, 1124499, 1125642, 1126785, 1127930, 1129076, 1130224, 1131372,
-1132522, 1133673, 1134825, 1135978, 1137132, 1138287, 1139444, 1140602,
-1141761, 1142921, 1144082, 1145245, 1146409, 1147573, 1148739, 1149907,
-1151075, 1152245, 1153416, 1154588, 1155761, 1156935, 1158111, 1159288,
-1160466, 1161645, 1162825, 1164007, 1165189, 1166373, 1167559, 1168745,
-1169933, 1171121, 1172311, 1173503, 1174695, 1175889, 1177083, 1178279,
-1179477, 1180675, 1181875, 1183076, 1184278, 1185481, 1186686, 1187892,
-1189099, 1190307, 1191517, 1192727, 1193939, 1195152, 1196367, 1197582,
-1198799, 1200017, 1201237, 1202457, 1203679, 1204902, 1206127, 1207352,
-1208579, 1209807, 1211036, 1212267, 1213499, 1214732, 1215966, 1217202,
-1218438, 1219677, 1220916, 1222156, 1223398, 1224641, 1225886, 1227131,
-1228378, 1229627, 1230876, 1232127, 1233379, 1234632, 1235886, 1237142,
-1238399, 1239658, 1240917, 1242178, 1243440, 1244704, 1245969, 1247235,
-1248502, 1249771, 1251041, 1252312, 1253584, 1254858, 1256133, 1257410,
-1258687, 1259966, 1261246, 1262528, 1263811, 1265095, 1266381, 1267667,
-1268955, 1270245, 1271536, 1272828, 1274121, 1275416, 1276712, 1278009,
-1279308, 1280607, 1281909, 1283211, 1284515, 1285820, 1287127, 1288435,
-1289744, 1291055, 1292366, 1293680, 1294994, 1296310, 1297627, 1298946,
-1300266, 1301587, 1302909, 1304233, 1305559, 1306885, 1308213, 1309542,
-1310873, 1312205, 1313538, 1314873, 1316209, 1317547, 1318885, 1320225,
-1321567, 1322910, 1324254, 1325600, 1326947, 1328295, 1329645, 1330996,
-1332348, 1333702, 1335057, 1336414, 1337772, 1339131, 1340492, 1341854,
-1343217, 1344582, 1345948, 1347316, 1348685, 1350056, 1351427, 1352801,
-1354175, 1355551, 1356929, 1358307, 1359688, 1361069, 1362452, 1363837,
-1365222, 1366610, 1367998, 1369388, 1370780, 1372173, 1373567, 1374963,
-1376360, 1377758, 1379158, 1380560, 1381962, 1383367, 1384772, 1386179,
-1387588, 1388998, 1390409, 1391822, 1393236, 1394652, 1396069, 1397488,
-1398908, 1400329, 1401752, 1403176, 1404602, 1406030, 1407458, 1408888,
-1410320, 1411753, 1413187, 1414623, 1416061, 1417500, 1418940, 1420382,
-1421825, 1423270, 1424716, 1426164, 1427613, 1429064, 1430516, 1431969,
-1433424, 1434881, 1436339, 1437798, 1439259, 1440722, 1442186, 1443651,
-1445118, 1446586, 1448056, 1449528, 1451001, 1452475, 1453951, 1455428,
-1456907, 1458388, 1459869, 1461353, 1462838, 1464324, 1465812, 1467302,
-1468792, 1470285, 1471779, 1473274, 1474771, 1476270, 1477770, 1479272,
-1480775, 1482279, 1483786, 1485293, 1486802, 1488313, 1489826, 1491339,
-1492855, 1494372, 1495890, 1497410, 1498932, 1500455, 1501979, 1503506,
-1505033, 1506563, 1508093, 1509626, 1511160, 1512695, 1514232, 1515771,
-1517311, 1518853, 1520396, 1521941, 1523488, 1525036, 1526585, 1528137,
-1529689, 1531244, 1532800, 1534357, 1535916, 1537477, 1539039, 1540603,
-1542168, 1543735, 1545304, 1546874, 1548446, 1550019, 1551594, 1553171,
-1554749, 1556329, 1557910, 1559493, 1561078, 1562664, 1564252, 1565842,
-1567433, 1569025, 1570620, 1572216, 1573813, 1575412, 1577013, 1578616,
-1580220, 1581825, 1583433, 1585042, 1586652, 1588264, 1589878, 1591494,
-1593111, 1594730, 1596350, 1597972, 1599596, 1601221, 1602848, 1604477,
-1606107, 1607739, 1609373, 1611008, 1612645, 1614284, 1615924, 1617566,
-1619210, 1620855, 1622502, 1624151, 1625801, 1627453, 1629107, 1630762,
-1632419, 1634078, 1635738, 1637400, 1639064, 1640730, 1642397, 1644066,
-1645736, 1647409, 1649083, 1650758, 1652436, 1654115, 1655795, 1657478,
-1659162, 1660848, 1662536, 1664225, 1665916, 1667609, 1669303, 1670999,
-1672697, 1674397, 1676098, 1677801, 1679506, 1681213, 1682921, 1684631,
-1686343, 1688057, 1689772, 1691489, 1693208, 1694928, 1696650, 1698374,
-1700100, 1701828, 1703557, 1705288, 1707021, 1708755, 1710491, 1712229,
-1713969, 1715711, 1717454, 1719199, 1720946, 1722695, 1724445, 1726198,
-1727952, 1729707, 1731465, 1733224, 1734986, 1736749, 1738513, 1740280,
-1742048, 1743818, 1745590, 1747364, 1749139, 1750917, 1752696, 1754477,
-1756260, 1758044, 1759831, 1761619, 1763409, 1765201, 1766994, 1768790,
-1770587, 1772386, 1774187, 1775990, 1777794, 1779601, 1781409, 1783219,
-1785031, 1786845, 1788661, 1790478, 1792298, 1794119, 1795942, 1797767,
-1799593, 1801422, 1803252, 1805085, 1806919, 1808755, 1810593, 1812433,
-1814274, 1816118, 1817963, 1819810, 1821660, 1823511, 1825363, 1827218,
-1829075, 1830933, 1832794, 1834656, 1836520, 1838387, 1840255, 1842125,
-1843996, 1845870, 1847746, 1849623, 1851503, 1853384, 1855267, 1857152,
-1859039, 1860928, 1862819, 1864712, 1866607, 1868504, 1870402, 1872303,
-1874205, 1876110, 1878016, 1879924, 1881835, 1883747, 1885661, 1887577,
-1889495, 1891415, 1893337, 1895261, 1897186, 1899114, 1901044, 1902976,
-1904909, 1906845, 1908782, 1910722, 1912663, 1914607, 1916552, 1918500,
-1920449, 1922401, 1924354, 1926309, 1928267, 1930226, 1932187, 1934151,
-1936116, 1938083, 1940053, 1942024, 1943997, 1945973, 1947950, 1949929,
-1951911, 1953894, 1955880, 1957867, 1959856, 1961848, 1963841, 1965837,
-1967834, 1969834, 1971835, 1973839, 1975845, 1977852, 1979862, 1981874,
-1983888, 1985904, 1987921, 1989941, 1991963, 1993987, 1996014, 1998042,
-2000072, 2002104, 2004139, 2006175, 2008214, 2010254, 2012297, 2014342,
-2016388, 2018437, 2020488, 2022541, 2024596, 2026654, 2028713, 2030774,
-2032838, 2034903, 2036971, 2039041, 2041113, 2043187, 2045263, 2047341,
-2049422, 2051504, 2053589, 2055675, 2057764, 2059855, 2061948, 2064043,
-2066141, 2068240, 2070342, 2072445, 2074551, 2076659, 2078769, 2080882,
-2082996, 2085112, 2087231, 2089352, 2091475, 2093600, 2095728, 2097857,
-2099989, 2102123, 2104259, 2106397, 2108537, 2110680, 2112824, 2114971,
-2117120, 2119272, 2121425, 2123581, 2125738, 2127898, 2130061, 2132225,
-2134392, 2136560, 2138731, 2140905, 2143080, 2145258, 2147437, 2149619,
-2151804, 2153990, 2156179, 2158370, 2160563, 2162758, 2164956, 2167156,
-2169358, 2171562, 2173769, 2175978, 2178189, 2180402, 2182617, 2184835,
-2187055, 2189278, 2191502, 2193729, 2195958, 2198189, 2200423, 2202659,
-2204897, 2207138, 2209380, 2211625, 2213872, 2216122, 2218374, 2220628,
-2222884, 2225143, 2227404, 2229667, 2231933, 2234201, 2236471, 2238744,
-2241018, 2243296, 2245575, 2247857, 2250141, 2252427, 2254716, 2257007,
-2259300, 2261596, 2263894, 2266195, 2268497, 2270802, 2273110, 2275420,
-2277732, 2280046, 2282363, 2284682, 2287004, 2289327, 2291654, 2293982,
-2296313, 2298646, 2300982, 2303320, 2305661, 2308003, 2310349, 2312696,
-2315046, 2317399, 2319753, 2322110, 2324470, 2326832, 2329196, 2331563,
-2333932, 2336304, 2338678, 2341054, 2343433, 2345814, 2348198, 2350584,
-2352972, 2355363, 2357756, 2360152, 2362550, 2364951, 2367354, 2369759,
-2372167, 2374578, 2376991, 2379406, 2381824, 2384244, 2386667, 2389092,
-2391519, 2393949, 2396382, 2398817, 2401254, 2403694, 2406137, 2408582,
-2411029, 2413479, 2415931, 2418386, 2420844, 2423303, 2425766, 2428231,
-2430698, 2433168, 2435640, 2438115, 2440593, 2443073, 2445555, 2448040,
-2450527, 2453017, 2455510, 2458005, 2460503, 2463003, 2465506, 2468011,
-2470519, 2473029, 2475542, 2478057, 2480575, 2483096, 2485619, 2488145,
-2490673, 2493204, 2495737, 2498273, 2500812, 2503353, 2505896, 2508443,
-2510991, 2513543, 2516097, 2518654, 2521213, 2523775, 2526339, 2528906,
-2531476, 2534048, 2536623, 2539201, 2541781, 2544363, 2546949, 2549537,
-2552127, 2554721, 2557317, 2559915, 2562516, 2565120, 2567727, 2570336,
-2572947, 2575562, 2578179, 2580799, 2583421, 2586046, 2588674, 2591304,
-2593937, 2596573, 2599211, 2601853, 2604496, 2607143, 2609792, 2612444,
-2615098, 2617756, 2620416, 2623078, 2625744, 2628412, 2631082, 2633756,
-2636432, 2639111, 2641793, 2644477, 2647164, 2649854, 2652546, 2655242,
-2657940, 2660641, 2663344, 2666050, 2668759, 2671471, 2674186, 2676903,
-2679623, 2682346, 2685071, 2687800, 2690531, 2693265, 2696001, 2698741,
-2701483, 2704228, 2706976, 2709727, 2712480, 2715236, 2717995, 2720757,
-2723522, 2726289, 2729059, 2731832, 2734608, 2737387, 2740168, 2742953,
-2745740, 2748530, 2751323, 2754118, 2756917, 2759718, 2762522, 2765329,
-2768139, 2770952, 2773768, 2776586, 2779407, 2782232, 2785059, 2787889,
-2790721, 2793557, 2796396, 2799237, 2802082, 2804929, 2807779, 2810632,
-2813488, 2816347, 2819208, 2822073, 2824941, 2827811, 2830684, 2833561,
-2836440, 2839322, 2842207, 2845095, 2847986, 2850880, 2853777, 2856677,
-2859579, 2862485, 2865394, 2868305, 2871220, 2874137, 2877058, 2879981,
-2882908, 2885837, 2888769, 2891705, 2894643, 2897584, 2900528, 2903476,
-2906426, 2909379, 2912336, 2915295, 2918257, 2921222, 2924191, 2927162,
-2930136, 2933114, 2936094, 2939078, 2942064, 2945053, 2948046, 2951042,
-2954040, 2957042, 2960046, 2963054, 2966065, 2969079, 2972096, 2975116,
-2978139, 2981165, 2984194, 2987227, 2990262, 2993300, 2996342, 2999387,
-3002434, 3005485, 3008539, 3011596, 3014656, 3017719, 3020786, 3023855,
-3026928, 3030004, 3033082, 3036164, 3039249, 3042338, 3045429, 3048524,
-3051621, 3054722, 3057826, 3060933, 3064043, 3067157, 3070273, 3073393,
-3076516, 3079642, 3082771, 3085904, 3089039, 3092178, 3095320, 3098465,
-3101614, 3104765, 3107920, 3111078, 3114240, 3117404, 3120572, 3123742,
-3126917, 3130094, 3133274, 3136458, 3139645, 3142835, 3146029, 3149226,
-3152426, 3155629, 3158835, 3162045, 3165258, 3168474, 3171694, 3174917,
-3178143, 3181372, 3184605, 3187841, 3191080, 3194322, 3197568, 3200817,
-3204070, 3207325, 3210584, 3213847, 3217112, 3220381, 3223654, 3226929,
-3230208, 3233490, 3236776, 3240065, 3243357, 3246653, 3249952, 3253254,
-3256560, 3259869, 3263181, 3266497, 3269816, 3273139, 3276465, 3279794,
-3283127, 3286463, 3289802, 3293145, 3296491, 3299841, 3303194, 3306550,
-3309910, 3313273, 3316640, 3320010, 3323384, 3326761, 3330141, 3333525,
-3336912, 3340303, 3343697, 3347094, 3350495, 3353900, 3357308, 3360719,
-3364134, 3367553, 3370974, 3374400, 3377828, 3381261, 3384696, 3388136,
-3391578, 3395025, 3398474, 3401928, 3405384, 3408845, 3412308, 3415776,
-3419247, 3422721, 3426199, 3429680, 3433165, 3436654, 3440146, 3443641,
-3447140, 3450643, 3454149, 3457659, 3461173, 3464690, 3468210, 3471734,
-3475262, 3478793, 3482328, 3485866, 3489408, 3492954, 3496503, 3500056,
-3503613, 3507173, 3510736, 3514304, 3517875, 3521449, 3525028, 3528609,
-3532195, 3535784, 3539377, 3542973, 3546573, 3550177, 3553784, 3557395,
-3561010, 3564629, 3568251, 3571876, 3575506, 3579139, 3582776, 3586416,
-3590060, 3593708, 3597360, 3601015, 3604674, 3608337, 3612004, 3615674,
-3619348, 3623025, 3626707, 3630392, 3634081, 3637774, 3641470, 3645170,
-3648874, 3652582, 3656293, 3660008, 3663727, 3667450, 3671177, 3674907,
-3678641, 3682379, 3686121, 3689866, 3693616, 3697369, 3701126, 3704887,
-3708651, 3712420, 3716192, 3719968, 3723748, 3727532, 3731319, 3735111,
-3738906, 3742705, 3746508, 3750315, 3754126, 3757940, 3761759, 3765581,
-3769408, 3773238, 3777072, 3780910, 3784752, 3788597, 3792447, 3796301,
-3800158, 3804019, 3807885, 3811754, 3815627, 3819504, 3823385, 3827270,
-3831159, 3835052, 3838949, 3842850, 3846755, 3850664, 3854576, 3858493,
-3862414, 3866338, 3870267, 3874200, 3878136, 3882077, 3886021, 3889970,
-3893923, 3897879, 3901840, 3905805, 3909774, 3913746, 3917723, 3921704,
-3925689, 3929678, 3933671, 3937668, 3941669, 3945674, 3949684, 3953697,
-3957714, 3961736, 3965761, 3969791, 3973825, 3977863, 3981905, 3985951,
-3990001, 3994055, 3998114, 4002176, 4006243, 4010314, 4014389, 4018468,
-4022551, 4026638, 4030730, 4034826, 4038926, 4043030, 4047138, 4051250,
-4055367, 4059487, 4063612, 4067741, 4071875, 4076012, 4080154, 4084300,
-4088450, 4092604, 4096763, 4100926, 4105093, 4109264, 4113439, 4117619,
-4121803, 4125991, 4130184, 4134381, 4138582, 4142787, 4146996, 4151210,
-4155428, 4159651, 4163877, 4168108, 4172344, 4176583, 4180827, 4185075,
-4189328, 4193585, 4197846, 4202111, 4206381, 4210655, 4214934, 4219217,
-4223504, 4227796, 4232091, 4236392, 4240696, 4245005, 4249319, 4253637,
-4257959, 4262285, 4266616, 4270952, 4275292, 4279636, 4283984, 4288337,
-4292695, 4297057, 4301423, 4305794, 4310169, 4314549, 4318933, 4323321,
-4327714, 4332112, 4336514, 4340920, 4345331, 4349746, 4354166, 4358590,
-4363019, 4367453, 4371890, 4376333, 4380780, 4385231, 4389687, 4394147,
-4398612, 4403082, 4407556, 4412035, 4416518, 4421005, 4425498, 4429994,
-4434496, 4439002, 4443512, 4448027, 4452547, 4457071, 4461600, 4466134,
-4470672, 4475215, 4479762, 4484314, 4488871, 4493432, 4497998, 4502568,
-4507143, 4511723, 4516307, 4520897, 4525490, 4530089, 4534692, 4539300,
-4543912, 4548529, 4553151, 4557778, 4562409, 4567045, 4571685, 4576331,
-4580981, 4585636, 4590295, 4594959, 4599629, 4604302, 4608981, 4613664,
-4618352, 4623045, 4627742, 4632445, 4637152, 4641864, 4646580, 4651302,
-4656028, 4660759, 4665495, 4670236, 4674981, 4679732, 4684487, 4689247,
-4694012, 4698781, 4703556, 4708335, 4713119, 4717908, 4722702, 4727501,
-4732305, 4737113, 4741927, 4746745, 4751568, 4756397, 4761230, 4766068,
-4770910, 4775758, 4780611, 4785469, 4790331, 4795199, 4800071, 4804949,
-4809831, 4814718, 4819611, 4824508, 4829410, 4834317, 4839230, 4844147,
-4849069, 4853996, 4858929, 4863866, 4868808, 4873755, 4878708, 4883665,
-4888627, 4893595, 4898567, 4903545, 4908527, 4913515, 4918508, 4923505,
-4928508, 4933516, 4938529, 4943547, 4948571, 4953599, 4958632, 4963671,
-4968715, 4973763, 4978817, 4983876, 4988941, 4994010, 4999084, 5004164,
-5009249, 5014339, 5019434, 5024534, 5029640, 5034751, 5039866, 5044987,
-5050114, 5055245, 5060382, 5065524, 5070671, 5075823, 5080981, 5086144,
-5091312, 5096485, 5101664, 5106848, 5112037, 5117232, 5122431, 5127636,
-5132847, 5138062, 5143283, 5148509, 5153741, 5158977, 5164220, 5169467,
-5174720, 5179978, 5185241, 5190510, 5195784, 5201064, 5206349, 5211639,
-5216935, 5222236, 5227542, 5232854, 5238171, 5243494, 5248822, 5254155,
-5259494, 5264838, 5270188, 5275543, 5280903, 5286269, 5291641, 5297018,
-5302400, 5307788, 5313181, 5318580, 5323985, 5329394, 5334810, 5340230,
-5345657, 5351088, 5356526, 5361969, 5367417, 5372871, 5378330, 5383795,
-5389266, 5394742, 5400224, 5405711, 5411204, 5416702, 5422206, 5427716,
-5433231, 5438752, 5444278, 5449810, 5455348, 5460891, 5466440, 5471995,
-5477555, 5483121, 5488692, 5494269, 5499852, 5505441, 5511035, 5516635,
-5522240, 5527851, 5533468, 5539091, 5544719, 5550353, 5555993, 5561639,
-5567290, 5572947, 5578610, 5584278, 5589953, 5595633, 5601318, 5607010,
-5612707, 5618411, 5624120, 5629834, 5635555, 5641281, 5647013, 5652751,
-5658495, 5664245, 5670001, 5675762, 5681529, 5687302, 5693081, 5698866,
-5704657, 5710453, 5716256, 5722064, 5727879, 5733699, 5739525, 5745357,
-5751195, 5757039, 5762888, 5768744, 5774606, 5780474, 5786347, 5792227,
-5798112, 5804004, 5809902, 5815805, 5821715, 5827630, 5833552, 5839479,
-5845413, 5851352, 5857298, 5863250, 5869208, 5875171, 5881141, 5887117,
-5893099, 5899087, 5905081, 5911082, 5917088, 5923100, 5929119, 5935144,
-5941174, 5947211, 5953254, 5959304, 5965359, 5971420, 5977488, 5983562,
-5989642, 5995728, 6001820, 6007919, 6014024, 6020135, 6026252, 6032375,
-6038505, 6044641, 6050783, 6056931, 6063086, 6069246, 6075413, 6081587,
-6087766, 6093952, 6100144, 6106343, 6112548, 6118759, 6124976, 6131200,
-6137430, 6143666, 6149909, 6156158, 6162413, 6168675, 6174943, 6181217,
-6187498, 6193785, 6200079, 6206379, 6212685, 6218998, 6225318, 6231643,
-6237975, 6244314, 6250659, 6257010, 6263368, 6269732, 6276103, 6282480,
-6288864, 6295254, 6301651, 6308054, 6314464, 6320880, 6327303, 6333732,
-6340168, 6346610, 6353059, 6359515, 6365977, 6372445, 6378920, 6385402,
-6391890, 6398385, 6404887, 6411395, 6417910, 6424431, 6430959, 6437494,
-6444035, 6450583, 6457137, 6463698, 6470266, 6476841, 6483422, 6490010,
-6496605, 6503206, 6509814, 6516429, 6523050, 6529678, 6536313, 6542955,
-6549603, 6556258, 6562920, 6569589, 6576264, 6582947, 6589636, 6596332,
-6603034, 6609744, 6616460, 6623183, 6629913, 6636650, 6643393, 6650144,
-6656901, 6663665, 6670436, 6677214, 6683999, 6690791, 6697589, 6704395,
-6711207, 6718027, 6724853, 6731686, 6738526, 6745374, 6752228, 6759089,
-6765957, 6772832, 6779714, 6786603, 6793499, 6800402, 6807312, 6814229,
-6821153, 6828084, 6835022, 6841967, 6848919, 6855879, 6862845, 6869818,
-6876799, 6883787, 6890781, 6897783, 6904792, 6911808, 6918831, 6925862,
-6932899, 6939944, 6946996, 6954055, 6961121, 6968194, 6975275, 6982362,
-6989457, 6996559, 7003669, 7010785, 7017909, 7025040, 7032178, 7039324,
-7046476, 7053636, 7060804, 7067978, 7075160, 7082349, 7089546, 7096750,
-7103961, 7111179, 7118405, 7125638, 7132879, 7140127, 7147382, 7154644,
-7161914, 7169192, 7176476, 7183768, 7191068, 7198375, 7205689, 7213011,
-7220340, 7227677, 7235021, 7242373, 7249732, 7257099, 7264473, 7271854,
-7279243, 7286640, 7294044, 7301455, 7308875, 7316301, 7323735, 7331177,
-7338627, 7346083, 7353548, 7361020, 7368500, 7375987, 7383482, 7390984,
-7398494, 7406012, 7413537, 7421070, 7428611, 7436159, 7443715, 7451279,
-7458850, 7466430, 7474016, 7481611, 7489213, 7496823, 7504440, 7512066,
-7519699, 7527340, 7534989, 7542645, 7550309, 7557981, 7565661, 7573349,
-7581044, 7588747, 7596458, 7604177, 7611904, 7619638, 7627381, 7635131,
-7642889, 7650655, 7658429, 7666211, 7674001, 7681799, 7689604, 7697418,
-7705239, 7713069, 7720906, 7728751, 7736605, 7744466, 7752335, 7760213,
-7768098, 7775991, 7783892, 7791802, 7799719, 7807645, 7815578, 7823520,
-7831469, 7839427, 7847393, 7855366, 7863348, 7871339, 7879337, 7887343,
-7895357, 7903380, 7911411, 7919450, 7927497, 7935552, 7943616, 7951687,
-7959767, 7967855, 7975951, 7984056, 7992169, 8000290, 8008419, 8016556,
-8024702, 8032856, 8041018, 8049189, 8057368, 8065555, 8073751, 8081954,
-8090167, 8098387, 8106616, 8114853, 8123099, 8131353, 8139615, 8147886,
-8156165, 8164453, 8172749, 8181054, 8189366, 8197688, 8206018, 8214356,
-8222703, 8231058, 8239422, 8247794, 8256174, 8264564, 8272961, 8281368,
-8289783, 8298206, 8306638, 8315078, 8323528, 8331985, 8340451, 8348926,
-8357410, 8365902, 8374403, 8382912, 8391430, 8399957, 8408492, 8417036,
-8425589, 8434150, 8442720, 8451299, 8459886, 8468483, 8477088, 8485701,
-8494324, 8502955, 8511595, 8520244, 8528901, 8537568, 8546243, 8554927,
-8563620, 8572321, 8581032, 8589751, 8598479, 8607216, 8615962, 8624717,
-8633481, 8642253, 8651035, 8659825, 8668625, 8677433, 8686250, 8695077,
-8703912, 8712756, 8721609, 8730471, 8739343, 8748223, 8757112, 8766010,
-8774917, 8783834, 8792759, 8801694, 8810637, 8819590, 8828552, 8837522,
-8846502, 8855491, 8864490, 8873497, 8882513, 8891539, 8900574, 8909618,
-8918671, 8927734, 8936805, 8945886, 8954976, 8964075, 8973184, 8982302,
-8991429, 9000565, 9009711, 9018866, 9028030, 9037203, 9046386, 9055578,
-9064780, 9073991, 9083211, 9092441, 9101680, 9110928, 9120186, 9129453,
-9138730, 9148016, 9157311, 9166616, 9175930, 9185254, 9194587, 9203930,
-9213282, 9222644, 9232015, 9241396, 9250787, 9260186, 9269596, 9279015,
-9288443, 9297882, 9307329, 9316787, 9326253, 9335730, 9345216, 9354712,
-9364218, 9373733, 9383257, 9392792, 9402336, 9411890, 9421454, 9431027,
-9440610, 9450203, 9459805, 9469417, 9479039, 9488671, 9498313, 9507964,
-9517625, 9527296, 9536977, 9546668, 9556368, 9566079, 9575799, 9585529,
-9595269, 9605019, 9614779, 9624549, 9634328, 9644118, 9653917, 9663727,
-9673546, 9683376, 9693215, 9703065, 9712924, 9722794, 9732673, 9742563,
-9752462, 9762372, 9772292, 9782221, 9792161, 9802111, 9812071, 9822042,
-9832022, 9842012, 9852013, 9862024, 9872045, 9882076, 9892117, 9902169,
-9912231, 9922302, 9932385, 9942477, 9952580, 9962693, 9972816, 9982950,
-9993093, 10003248, 10013412, 10023587, 10033772, 10043967, 10054173, 10064390,
-10074616, 10084853, 10095100, 10105358, 10115626, 10125905, 10136194, 10146494,
-10156804, 10167124, 10177455, 10187797, 10198149, 10208511, 10218884, 10229268,
-10239662, 10250067, 10260482, 10270908, 10281344, 10291791, 10302249, 10312717,
-10323196, 10333686, 10344186, 10354697, 10365218, 10375751, 10386294, 10396847,
-10407412, 10417987, 10428573, 10439169, 10449777, 10460395, 10471024, 10481664,
-10492314, 10502976, 10513648, 10524331, 10535025, 10545730, 10556445, 10567172,
-10577910, 10588658, 10599417, 10610187, 10620969, 10631761, 10642564, 10653378,
-10664203, 10675039, 10685886, 10696744, 10707613, 10718494, 10729385, 10740287,
-10751201, 10762125, 10773061, 10784007, 10794965, 10805934, 10816914, 10827905,
-10838908, 10849921, 10860946, 10871982, 10883029, 10894088, 10905157, 10916238,
-10927330, 10938434, 10949549, 10960675, 10971812, 10982961, 10994121, 11005292,
-11016474, 11027668, 11038874, 11050091, 11061319, 11072558, 11083809, 11095072,
-11106346, 11117631, 11128928, 11140236, 11151556, 11162887, 11174230, 11185584,
-11196950, 11208328, 11219717, 11231117, 11242529, 11253953, 11265388, 11276835,
-11288294, 11299764, 11311246, 11322739, 11334245, 11345762, 11357290, 11368830,
-11380383, 11391946, 11403522, 11415109, 11426708, 11438319, 11449942, 11461576,
-11473223, 11484881, 11496551, 11508232, 11519926, 11531632, 11543349, 11555079,
-11566820, 11578573, 11590338, 11602115, 11613905, 11625706, 11637519, 11649344,
-11661181, 11673030, 11684891, 11696764, 11708650, 11720547, 11732456, 11744378,
-11756312, 11768257, 11780215, 11792185, 11804168, 11816162, 11828169, 11840187,
-11852218, 11864262, 11876317, 11888385, 11900465, 11912557, 11924662, 11936778,
-11948908, 11961049, 11973203, 11985369, 11997548, 12009738, 12021942, 12034157,
-12046386, 12058626, 12070879, 12083144, 12095422, 12107713, 12120016, 12132331,
-12144659, 12156999, 12169352, 12181717, 12194096, 12206486, 12218889, 12231305,
-12243734, 12256175, 12268628, 12281095, 12293574, 12306065, 12318570, 12331087,
-12343617, 12356159, 12368715, 12381283, 12393863, 12406457, 12419063, 12431683,
-12444315, 12456960, 12469617, 12482288, 12494971, 12507668, 12520377, 12533099,
-12545834, 12558582, 12571343, 12584117, 12596904, 12609704, 12622517, 12635343,
-12648182, 12661034, 12673899, 12686777, 12699668, 12712573, 12725490, 12738421,
-12751364, 12764321, 12777291, 12790274, 12803271, 12816281, 12829303, 12842339,
-12855389, 12868451, 12881527, 12894616, 12907719, 12920834, 12933963, 12947106,
-12960262, 12973431, 12986613, 12999809, 13013019, 13026241, 13039477, 13052727,
-13065990, 13079267, 13092557, 13105860, 13119177, 13132508, 13145852, 13159210,
-13172581, 13185966, 13199365, 13212777, 13226202, 13239642, 13253095, 13266561,
-13280042, 13293536, 13307044, 13320565, 13334100, 13347649, 13361212, 13374789,
-13388379, 13401983, 13415601, 13429233, 13442879, 13456538, 13470212, 13483899,
-13497600, 13511315, 13525044, 13538787, 13552544, 13566315, 13580100, 13593899,
-13607712, 13621539, 13635380, 13649235, 13663104, 13676988, 13690885, 13704797,
-13718722, 13732662, 13746616, 13760584, 13774567, 13788563, 13802574, 13816599,
-13830638, 13844692, 13858760, 13872842, 13886938, 13901049, 13915174, 13929313,
-13943467, 13957635, 13971818, 13986015, 14000226, 14014452, 14028693, 14042947,
-14057217, 14071500, 14085799, 14100112, 14114439, 14128781, 14143137, 14157508,
-14171894, 14186294, 14200709, 14215139, 14229583, 14244042, 14258516, 14273004,
-14287507, 14302025, 14316557, 14331104, 14345667, 14360243, 14374835, 14389442,
-14404063, 14418699, 14433350, 14448016, 14462697, 14477393, 14492103, 14506829,
-14521570, 14536325, 14551096, 14565882, 14580682, 14595498, 14610329, 14625174,
-14640035, 14654911, 14669802, 14684709, 14699630, 14714566, 14729518, 14744485,
-14759467, 14774465, 14789477, 14804505, 14819548, 14834606, 14849680, 14864769,
-14879873, 14894993, 14910128, 14925279, 14940444, 14955626, 14970822, 14986034,
-15001262, 15016505, 15031763, 15047037, 15062327, 15077632, 15092953, 15108289,
-15123641, 15139008, 15154391, 15169790, 15185204, 15200634, 15216079, 15231541,
-15247018, 15262511, 15278019, 15293543, 15309083, 15324639, 15340211, 15355798,
-15371401, 15387021, 15402656, 15418306, 15433973, 15449656, 15465355, 15481069,
-15496800, 15512546, 15528309, 15544087, 15559882, 15575693, 15591519, 15607362,
-15623221, 15639096, 15654987, 15670894, 15686818, 15702758, 15718713, 15734685,
-15750674, 15766678, 15782699, 15798736, 15814789, 15830859, 15846945, 15863047,
-15879166, 15895301, 15911453, 15927621, 15943805, 15960006, 15976223, 15992457,
-16008707, 16024973, 16041257, 16057556, 16073873, 16090206, 16106555, 16122921,
-16139304, 16155704, 16172120, 16188552, 16205002, 16221468, 16237951, 16254450,
-16270967, 16287500, 16304050, 16320617, 16337201, 16353801, 16370418, 16387053,
-16403704, 16420372, 16437057, 16453759, 16470478, 16487214, 16503967, 16520737,
-16537524, 16554328, 16571149, 16587987, 16604842, 16621715, 16638604, 16655511,
-16672435, 16689376, 16706334, 16723310, 16740303, 16757313, 16774340, 16791385,
-16808447, 16825526, 16842623, 16859737, 16876869, 16894017, 16911184, 16928367,
-16945569, 16962787, 16980023, 16997277, 17014548, 17031837, 17049143, 17066467,
-17083809, 17101168, 17118545, 17135939, 17153351, 17170781, 17188229, 17205694,
-17223177, 17240678, 17258196, 17275732, 17293287, 17310859, 17328448, 17346056,
-17363682, 17381325, 17398987, 17416666, 17434363, 17452079, 17469812, 17487563,
-17505333, 17523120, 17540926, 17558749, 17576591, 17594451, 17612329, 17630225,
-17648140, 17666072, 17684023, 17701992, 17719979, 17737985, 17756009, 17774051,
-17792111, 17810190, 17828287, 17846403, 17864537, 17882689, 17900860, 17919050,
-17937258, 17955484, 17973729, 17991992, 18010274, 18028575, 18046894, 18065231,
-18083588, 18101963, 18120357, 18138769, 18157200, 18175650, 18194118, 18212606,
-18231112, 18249637, 18268181, 18286743, 18305325, 18323925, 18342544, 18361182,
-18379839, 18398516, 18417211, 18435925, 18454658, 18473410, 18492181, 18510971,
-18529780, 18548609, 18567456, 18586323, 18605209, 18624114, 18643038, 18661982,
-18680944, 18699926, 18718928, 18737948, 18756988, 18776048, 18795126, 18814224,
-18833342, 18852478, 18871635, 18890811, 18910006, 18929221, 18948455, 18967709,
-18986982, 19006275, 19025588, 19044920, 19064272, 19083643, 19103034, 19122445,
-19141876, 19161326, 19180796, 19200286, 19219796, 19239326, 19258875, 19278444,
-19298033, 19317642, 19337271, 19356920, 19376589, 19396278, 19415987, 19435716,
-19455465, 19475234, 19495023, 19514832, 19534662, 19554511, 19574381, 19594270,
-19614181, 19634111, 19654061, 19674032, 19694023, 19714035, 19734066, 19754119,
-19774191, 19794284, 19814397, 19834531, 19854685, 19874860, 19895055, 19915271,
-19935507, 19955764, 19976041, 19996339, 20016658, 20036997, 20057357, 20077737,
-20098139, 20118561, 20139004, 20159467, 20179951, 20200457, 20220983, 20241530,
-20262097, 20282686, 20303295, 20323926, 20344577, 20365250, 20385943, 20406658,
-20427393, 20448150, 20468928, 20489727, 20510546, 20531388, 20552250, 20573133,
-20594038, 20614964, 20635911, 20656880, 20677869, 20698881, 20719913, 20740967,
-20762042, 20783139, 20804257, 20825396, 20846557, 20867740, 20888944, 20910170,
-20931417, 20952685, 20973976, 20995288, 21016621, 21037977, 21059354, 21080753,
-21102173, 21123615, 21145079, 21166565, 21188073, 21209602, 21231154, 21252727,
-21274322, 21295940, 21317579, 21339240, 21360923, 21382628, 21404355, 21426105,
-21447876, 21469670, 21491485, 21513323, 21535183, 21557066, 21578970, 21600897,
-21622846, 21644817, 21666811, 21688827, 21710865, 21732926, 21755009, 21777115,
-21799243, 21821393, 21843566, 21865762, 21887980, 21910221, 21932484, 21954770,
-21977079, 21999410, 22021764, 22044141, 22066540, 22088962, 22111407, 22133875,
-22156365, 22178879, 22201415, 22223974, 22246557, 22269162, 22291790, 22314441,
-22337115, 22359812, 22382532, 22405275, 22428042, 22450831, 22473644, 22496480,
-22519339, 22542221, 22565127, 22588055, 22611007, 22633983, 22656982, 22680004,
-22703049, 22726118, 22749211, 22772326, 22795466, 22818629, 22841815, 22865025,
-22888258, 22911516, 22934796, 22958101, 22981429, 23004781, 23028156, 23051555,
-23074978, 23098425, 23121896, 23145391, 23168909, 23192451, 23216017, 23239608,
-23263222, 23286860, 23310522, 23334208, 23357919, 23381653, 23405411, 23429194,
-23453001, 23476832, 23500687, 23524566, 23548470, 23572398, 23596350, 23620327,
-23644328, 23668353, 23692403, 23716477, 23740576, 23764699, 23788847, 23813019,
-23837216, 23861437, 23885683, 23909954, 23934249, 23958569, 23982914, 24007283,
-24031678, 24056097, 24080540, 24105009, 24129502, 24154021, 24178564, 24203132,
-24227726, 24252344, 24276987, 24301655, 24326348, 24351067, 24375810, 24400579,
-24425373, 24450192, 24475036, 24499906, 24524800, 24549720, 24574666, 24599636,
-24624633, 24649654, 24674701, 24699773, 24724871, 24749995, 24775143, 24800318,
-24825518, 24850743, 24875995, 24901272, 24926574, 24951902, 24977256, 25002636,
-25028042, 25053473, 25078931, 25104414, 25129923, 25155458, 25181018, 25206605,
-25232218, 25257857, 25283522, 25309213, 25334930, 25360673, 25386443, 25412238,
-25438060, 25463908, 25489782, 25515683, 25541610, 25567563, 25593543, 25619549,
-25645581, 25671640, 25697725, 25723837, 25749976, 25776141, 25802332, 25828550,
-25854795, 25881067, 25907365, 25933690, 25960041, 25986420, 26012825, 26039257,
-26065716, 26092202, 26118714, 26145254, 26171821, 26198414, 26225035, 26251683,
-26278357, 26305059, 26331788, 26358544, 26385328, 26412138, 26438976, 26465841,
-26492733, 26519653, 26546600, 26573575, 26600576, 26627606, 26654663, 26681747,
-26708858, 26735998, 26763165, 26790359, 26817581, 26844831, 26872109, 26899414,
-26926747, 26954107, 26981496, 27008912, 27036356, 27063828, 27091328, 27118856,
-27146412, 27173996, 27201608, 27229248, 27256916, 27284612, 27312337, 27340089,
-27367870, 27395679, 27423516, 27451382, 27479275, 27507197, 27535148, 27563127,
-27591134, 27619170, 27647234, 27675327, 27703448, 27731598, 27759777, 27787984,
-27816220, 27844484, 27872778, 27901100, 27929450, 27957830, 27986238, 28014676,
-28043142, 28071637, 28100161, 28128714, 28157296, 28185907, 28214547, 28243216,
-28271915, 28300642, 28329399, 28358185, 28387000, 28415845, 28444719, 28473622,
-28502554, 28531516, 28560508, 28589528, 28618579, 28647658, 28676768, 28705907,
-28735075, 28764273, 28793501, 28822759, 28852046, 28881363, 28910710, 28940087,
-28969493, 28998929, 29028396, 29057892, 29087418, 29116974, 29146561, 29176177,
-29205823, 29235500, 29265206, 29294943, 29324710, 29354508, 29384335, 29414193,
-29444081, 29474000, 29503949, 29533928, 29563938, 29593979, 29624050, 29654151,
-29684283, 29714446, 29744639, 29774863, 29805118, 29835403, 29865720, 29896067,
-29926444, 29956853, 29987293, 30017763, 30048265, 30078798, 30109361, 30139956,
-30170581, 30201238, 30231926, 30262645, 30293396, 30324177, 30354990, 30385834,
-30416710, 30447617, 30478555, 30509525, 30540526, 30571559, 30602623, 30633719,
-30664846, 30696005, 30727196, 30758418, 30789673, 30820958, 30852276, 30883626,
-30915007, 30946420, 30977865, 31009343, 31040852, 31072393, 31103966, 31135571,
-31167208, 31198878, 31230580, 31262314, 31294080, 31325878, 31357709, 31389572,
-31421467, 31453395, 31485356, 31517348, 31549374, 31581431, 31613522, 31645645,
-31677801, 31709989, 31742210, 31774464, 31806750, 31839070, 31871422, 31903807,
-31936225, 31968676, 32001160, 32033676, 32066226, 32098809, 32131426, 32164075,
-32196757, 32229473, 32262222, 32295004, 32327819, 32360668, 32393550, 32426466,
-32459415, 32492398, 32525414, 32558463, 32591546, 32624663, 32657814, 32690998,
-32724216, 32757467, 32790753, 32824072, 32857425, 32890812, 32924233, 32957688,
-32991177, 33024699, 33058256, 33091847, 33125473, 33159132, 33192825, 33226553,
-33260315, 33294112, 33327942, 33361807, 33395707, 33429641, 33463609, 33497612,
-33531649, 33565721, 33599828, 33633969, 33668146, 33702356, 33736602, 33770882,
-33805197, 33839547, 33873932, 33908352, 33942807, 33977297, 34011822, 34046381,
-34080977, 34115607, 34150272, 34184973, 34219709, 34254480, 34289286, 34324128,
-34359006, 34393918, 34428867, 34463850, 34498870, 34533925, 34569015, 34604141,
-34639303, 34674501, 34709734, 34745003, 34780308, 34815649, 34851025, 34886438,
-34921887, 34957372, 34992892, 35028449, 35064042, 35099671, 35135337, 35171038,
-35206776, 35242550, 35278361, 35314208, 35350091, 35386011, 35421967, 35457960,
-35493989, 35530055, 35566158, 35602297, 35638473, 35674686, 35710936, 35747222,
-35783546, 35819906, 35856303, 35892737, 35929208, 35965717, 36002262, 36038845,
-36075464, 36112121, 36148815, 36185547, 36222315, 36259121, 36295965, 36332846,
-36369764, 36406720, 36443714, 36480745, 36517813, 36554920, 36592064, 36629245,
-36666465, 36703722, 36741018, 36778351, 36815722, 36853131, 36890578, 36928063,
-36965586, 37003148, 37040747, 37078385, 37116061, 37153775, 37191528, 37229318,
-37267148, 37305015, 37342922, 37380866, 37418850, 37456872, 37494932, 37533031,
-37571169, 37609346, 37647561, 37685816, 37724109, 37762441, 37800812, 37839222,
-37877671, 37916159, 37954686, 37993253, 38031858, 38070503, 38109187, 38147911,
-38186673, 38225475, 38264317, 38303198, 38342118, 38381078, 38420078, 38459117,
-38498196, 38537315, 38576473, 38615671, 38654909, 38694187, 38733505, 38772863,
-38812261, 38851698, 38891176, 38930694, 38970252, 39009851, 39049489, 39089168,
-39128887, 39168647, 39208446, 39248287, 39288168, 39328089, 39368051, 39408053,
-39448097, 39488180, 39528305, 39568470, 39608676, 39648924, 39689211, 39729540,
-39769910, 39810321, 39850773, 39891266, 39931800, 39972375, 40012992, 40053650,
-40094349, 40135089, 40175871, 40216695, 40257560, 40298466, 40339414, 40380403,
-40421435, 40462507, 40503622, 40544778, 40585977, 40627217, 40668499, 40709823,
-40751189, 40792596, 40834046, 40875539, 40917073, 40958649, 41000268, 41041929,
-41083633, 41125378, 41167166, 41208997, 41250870, 41292786, 41334744, 41376745,
-41418789, 41460875, 41503004, 41545176, 41587391, 41629648, 41671949, 41714292,
-41756679, 41799109, 41841581, 41884097, 41926656, 41969259, 42011904, 42054593,
-42097326, 42140101, 42182921, 42225783, 42268690, 42311640, 42354633, 42397670,
-42440751, 42483876, 42527045, 42570257, 42613513, 42656814, 42700158, 42743546,
-42786979, 42830455, 42873976, 42917541, 42961150, 43004804, 43048501, 43092244,
-43136030, 43179862, 43223737, 43267658, 43311623, 43355632, 43399687, 43443786,
-43487930, 43532119, 43576352, 43620631, 43664955, 43709323, 43753737, 43798196,
-43842700, 43887249, 43931844, 43976484, 44021169, 44065899, 44110675, 44155497,
-44200364, 44245277, 44290235, 44335239, 44380289, 44425384, 44470526, 44515713,
-44560946, 44606225, 44651550, 44696922, 44742339, 44787802, 44833312, 44878868,
-44924470, 44970118, 45015813, 45061555, 45107342, 45153177, 45199057, 45244985,
-45290959, 45336980, 45383048, 45429162, 45475323, 45521532, 45567787, 45614089,
-45660438, 45706834, 45753278, 45799769, 45846306, 45892892, 45939524, 45986204,
-46032931, 46079706, 46126528, 46173398, 46220316, 46267281, 46314294, 46361355,
-46408463, 46455620, 46502824, 46550076, 46597377, 46644725, 46692121, 46739566,
-46787059, 46834600, 46882189, 46929827, 46977513, 47025248, 47073031, 47120863,
-47168743, 47216672, 47264649, 47312676, 47360751, 47408875, 47457048, 47505270,
-47553541, 47601861, 47650230, 47698648, 47747115, 47795632, 47844198, 47892813,
-47941478, 47990192, 48038955, 48087768, 48136631, 48185544, 48234506, 48283518,
-48332579, 48381691, 48430852, 48480064, 48529325, 48578636, 48627998, 48677410,
-48726871, 48776384, 48825946, 48875559, 48925222, 48974936, 49024700, 49074515,
-49124380, 49174296, 49224263, 49274281, 49324349, 49374468, 49424639, 49474860,
-49525132, 49575455, 49625830, 49676255, 49726732, 49777260, 49827840, 49878471,
-49929153, 49979887, 50030672, 50081509, 50132398, 50183338, 50234330, 50285374,
-50336470, 50387618, 50438817, 50490069, 50541373, 50592729, 50644137, 50695597,
-50747110, 50798675, 50850292, 50901962, 50953684, 51005459, 51057286, 51109167,
-51161099, 51213085, 51265124, 51317215, 51369359, 51421556, 51473807, 51526110,
-51578466, 51630876, 51683339, 51735855, 51788425, 51841048, 51893725, 51946455,
-51999238, 52052076, 52104967, 52157911, 52210910, 52263962, 52317068, 52370229,
-52423443, 52476711, 52530034, 52583410, 52636841, 52690326, 52743866, 52797460,
-52851108, 52904811, 52958568, 53012380, 53066247, 53120169, 53174145, 53228176,
-53282262, 53336403, 53390599, 53444850, 53499156, 53553517, 53607934, 53662406,
-53716933, 53771516, 53826154, 53880848, 53935597, 53990402, 54045262, 54100178,
-54155150, 54210178, 54265262, 54320402, 54375598, 54430850, 54486158, 54541522,
-54596943, 54652419, 54707953, 54763542, 54819188, 54874891, 54930650, 54986466,
-55042339, 55098268, 55154255, 55210298, 55266398, 55322555, 55378769, 55435040,
-55491369, 55547754, 55604197, 55660698, 55717255, 55773871, 55830543, 55887274,
-55944062, 56000907, 56057811, 56114772, 56171791, 56228868, 56286003, 56343196,
-56400448, 56457757, 56515125, 56572551, 56630035, 56687577, 56745179, 56802838,
-56860557, 56918334, 56976169, 57034064, 57092017, 57150029, 57208100, 57266230,
-};
-
 inline constexpr StereoTable RIBBON_TABLE = {
   {-10118, -31900, -24986, -28493, -25382, -26609, -23881, -24183,
     -21800, -21757, -19629, -19385, -17454, -17059, -15270, -14788,
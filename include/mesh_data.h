@@ -6,6 +6,21 @@ struct Point3D
 {
     int16_t x, y, z;
 };
+
+// Delta-encoded mesh path, emitted by util/mesh_prep.py --delta.
+//
+// The stream holds one byte per axis per point: a signed delta from the
+// previous point's axis, with -128 (0x80) as an escape followed by the
+// absolute int16 value little-endian. The first point is three escaped
+// absolutes. Small connected meshes encode near 3 bytes/point against
+// 6 for the expanded Point3D form, and the decoder (DeltaMesh in
+// oscillator.h) walks the stream sequentially so flash reads stay
+// linear instead of random.
+struct DeltaMeshPath
+{
+    const uint8_t *data; // encoded stream
+    uint32_t count;      // number of points
+};
 constexpr uint32_t CUBE_PATH_COUNT = 16;
 constexpr Point3D CUBE_PATH[] = {
     {2047, 2047, -2047},
@@ -39,8 +54,8 @@ constexpr Point3D CONE_PATH[] = {
     {0, -2047, 2047},
     {-2047, -2047, 0},
 };
-const uint32_t ICOSPHERE_PATH_COUNT = 36;
-const Point3D ICOSPHERE_PATH[] = {
+constexpr uint32_t ICOSPHERE_PATH_COUNT = 36;
+constexpr Point3D ICOSPHERE_PATH[] = {
     {-1831, -915, 0},
     {-566, -915, -1741},
     {566, 915, -1741},
@@ -3,22 +3,94 @@
 #include "ComputerCard.h"
 #include <cstdint>
 #include <cmath>
-#include "lookup_tables.h"
+#include "table_ram.h"
+#include "interp_lerp.h"
 #include "mesh_data.h"
+#include "fixed_point.h"
 
 // Base Oscillator class
 class Oscillator
 {
+public:
+    // Per-sample beam intensity (Z blanking). Oscillators that can
+    // tell a retrace or repositioning jump from real drawing write one
+    // intensity per rendered sample into zBuf alongside out[0]/out[1]:
+    // 0 blanks the beam, BEAM_ON is full brightness. The host points
+    // zBuf at a block buffer before rendering and mirrors it to the
+    // precise CV out for the scope's Z input. Oscillators that leave
+    // zSupported false pay nothing.
+    static constexpr int32_t BEAM_ON = 2047;
+    void SetZBuffer(int32_t *z) { zBuf = z; }
+    bool HasZ() const { return zSupported; }
+
 protected:
+    int32_t *zBuf = nullptr;
+    bool zSupported = false;
+    int32_t zCur = BEAM_ON; // intensity of the sample being computed
+
     // Shared waveform
     int32_t __not_in_flash_func(sine)(uint32_t ph)
     {
         // From ComputerCard sine_wave_lookup example
         uint32_t index = ph >> 23;        // convert from 32-bit phase to 9-bit lookup table index
         int32_t r = (ph & 0x7FFFFF) >> 7; // fractional part is last 23 bits of phase, shifted to 16-bit
-        int32_t s1 = SINE_TABLE[index];
-        int32_t s2 = SINE_TABLE[(index + 1) & 0x1FF];
-        return (s2 * r + s1 * (65536 - r)) >> 20;
+        int32_t s1 = TableRam::Sine[index];
+        int32_t s2 = TableRam::Sine[(index + 1) & 0x1FF];
+        return InterpLerp::Blend(s1, s2, r) >> 4;
+    }
+
+    // Fused sine/cosine sharing one index/fraction extraction: the
+    // cosine entries sit a fixed quarter table (128 entries) ahead of
+    // the sine entries, so the pair costs two extra fetches instead of
+    // a second full lookup. Worth it for every rotating oscillator.
+    void __not_in_flash_func(sincos)(uint32_t ph, int32_t &s, int32_t &c)
+    {
+        uint32_t index = ph >> 23;
+        int32_t r = (ph & 0x7FFFFF) >> 7;
+        int32_t s1 = TableRam::Sine[index];
+        int32_t s2 = TableRam::Sine[(index + 1) & 0x1FF];
+        int32_t c1 = TableRam::Sine[(index + 128) & 0x1FF];
+        int32_t c2 = TableRam::Sine[(index + 129) & 0x1FF];
+        s = InterpLerp::Blend(s1, s2, r) >> 4;
+        c = InterpLerp::Blend(c1, c2, r) >> 4;
+    }
+
+    // Control-rate rotation matrix. mod_rot only moves at knob/CV speed,
+    // so the rotating oscillators seed sin/cos from the table once per
+    // block and advance the pair per sample with the incremental rotation
+    // recurrence: two multiply-adds instead of two table lookups plus
+    // blends. The seed is re-read from the table at every block start,
+    // so rounding drift is bounded by one block and never accumulates.
+    struct RotState
+    {
+        int32_t s, c;   // current sin/cos at table scale (+-2000)
+        int32_t ds, dc; // per-sample step, Q15
+    };
+
+    // The step angle is at most 2048<<11 out of 2^32 of a turn
+    // (~0.006 rad), so sin(x)=x and cos(x)=1-x^2/2 are exact to below
+    // one Q15 LSB here - cheaper and more accurate than the table, and
+    // keeping |ds,dc| at unit length matters: a step pair even slightly
+    // short would shrink the figure a little more every sample.
+    static void __not_in_flash_func(rotStepQ15)(uint32_t step, int32_t &ds, int32_t &dc)
+    {
+        ds = FixedPoint::MulHiS((int32_t)step, 205887); // 2*pi in Q15
+        dc = 32768 - ((ds * ds) >> 16);
+    }
+
+    void __not_in_flash_func(rotSeed)(RotState &r, uint32_t ph, uint32_t step)
+    {
+        sincos(ph, r.s, r.c);
+        rotStepQ15(step, r.ds, r.dc);
+    }
+
+    // Round to nearest: a truncating shift would bias both components
+    // by up to an LSB per step, which adds up over a block
+    static void __not_in_flash_func(rotAdvance)(RotState &r)
+    {
+        int32_t ns = (r.s * r.dc + r.c * r.ds + 16384) >> 15;
+        r.c = (r.c * r.dc - r.s * r.ds + 16384) >> 15;
+        r.s = ns;
     }
 
     int32_t __not_in_flash_func(saw)(uint32_t ph)
@@ -37,12 +109,158 @@ protected:
         return (ph & 0x80000000) ? 2047 : -2048;
     }
 
+    // Band-limited primitives. The naive shapes above alias hard in the
+    // upper register; these add a polyBLEP (step) or polyBLAMP (corner)
+    // residual within one sample of each discontinuity, read from the
+    // precomputed tables in TableRam. Away from a discontinuity they
+    // cost two compares over the naive versions; near one, a single
+    // interpolated lookup plus a divide on the RP2040 hardware divider.
+    // inc is the per-sample phase increment the caller renders ph with
+    // (pass the sub-increment when oversampling).
+
+    // Q16 position within the one-sample transition region
+    static uint32_t __not_in_flash_func(blepFrac)(uint32_t d, uint32_t inc)
+    {
+        // keep the divide 32/32 for the hardware divider
+        if (uint32_t hi = inc >> 16)
+        {
+            int sh = 32 - __builtin_clz(hi);
+            d >>= sh;
+            inc >>= sh;
+        }
+        uint32_t u = (d << 16) / inc;
+        return u > 0xFFFF ? 0xFFFF : u;
+    }
+
+    static int32_t __not_in_flash_func(residualLookup)(const int32_t *table, uint32_t u)
+    {
+        uint32_t index = u >> 10; // 64 intervals
+        int32_t r = (int32_t)((u & 0x3FF) << 6);
+        return InterpLerp::Blend(table[index], table[index + 1], r);
+    }
+
+    // Signed Q15 step residual around a discontinuity at phase `edge`:
+    // -res just after the edge, +res just before, 0 elsewhere. Callers
+    // scale it by half the signed step height.
+    int32_t __not_in_flash_func(blepAt)(uint32_t ph, uint32_t inc, uint32_t edge)
+    {
+        uint32_t d = ph - edge; // wraps, so both sides test cheaply
+        if (d < inc)
+            return -residualLookup(TableRam::Blep, blepFrac(d, inc));
+        d = edge - ph;
+        if (d < inc)
+            return residualLookup(TableRam::Blep, blepFrac(d, inc));
+        return 0;
+    }
+
+    // Q15 corner residual: same magnitude on both sides of the corner
+    int32_t __not_in_flash_func(blampAt)(uint32_t ph, uint32_t inc, uint32_t edge)
+    {
+        uint32_t d = ph - edge;
+        if (d >= inc)
+            d = edge - ph;
+        if (d >= inc)
+            return 0;
+        return residualLookup(TableRam::Blamp, blepFrac(d, inc));
+    }
+
+    // Corner residual scaled to output units: (inc >> 19) is the tri
+    // slope per sample, the slope change at a corner is twice that, and
+    // the polyBLAMP residual is (slope change / 6) * (1-u)^3
+    static int32_t __not_in_flash_func(blampScale)(uint32_t inc, int32_t res)
+    {
+        int32_t t = (int32_t)((inc >> 10) * ((uint32_t)res >> 5)) >> 11;
+        return (t * 21845) >> 24; // divide by 3 via Q16 reciprocal
+    }
+
+    int32_t __not_in_flash_func(sawBL)(uint32_t ph, uint32_t inc)
+    {
+        // one -4096 step where the ramp wraps, at half phase
+        return saw(ph) + ((-2048 * blepAt(ph, inc, 0x80000000u)) >> 15);
+    }
+
+    int32_t __not_in_flash_func(sqrBL)(uint32_t ph, uint32_t inc)
+    {
+        // +4096 step at half phase, -4096 at the wrap
+        return sqr(ph) + ((2048 * (blepAt(ph, inc, 0x80000000u) - blepAt(ph, inc, 0))) >> 15);
+    }
+
+    int32_t __not_in_flash_func(triBL)(uint32_t ph, uint32_t inc)
+    {
+        // slope flips down at the peak (half phase), up at the trough
+        int32_t out = tri(ph);
+        int32_t r = blampAt(ph, inc, 0x80000000u);
+        if (r)
+            out -= blampScale(inc, r);
+        r = blampAt(ph, inc, 0);
+        if (r)
+            out += blampScale(inc, r);
+        return out;
+    }
+
+    // Clamp raw knob/mod sum to 0-4096 and widen to a 32-bit scale factor
+    static uint32_t __not_in_flash_func(growFactor)(int32_t mod_grow)
+    {
+        return (uint32_t)FixedPoint::Clamp(mod_grow, 0, 4096) << 20;
+    }
+
+    // Pick the mip level whose highest harmonic stays below Nyquist for
+    // this phase increment (one level per octave, conservative). Blocks
+    // rendered at 2x/4x oversampling pass their sub-increment here, which
+    // relaxes the level by one or two octaves for free.
+    static int __not_in_flash_func(mipLevel)(uint32_t inc)
+    {
+        if (inc < (1u << 22))
+            return 0;
+        int lvl = 10 - __builtin_clz(inc);
+        return lvl > StereoTableMip::levels - 1 ? StereoTableMip::levels - 1 : lvl;
+    }
+
+    // Linear interpolation into a 2^sizeLog2-entry table; with
+    // sizeLog2 == 10 this matches the old lookup1024 exactly
+    static int32_t __not_in_flash_func(lookupMip)(uint32_t ph, const int16_t *table, int sizeLog2)
+    {
+        uint32_t index = ph >> (32 - sizeLog2);
+        uint32_t mask = (1u << sizeLog2) - 1;
+        uint32_t r = (uint32_t)(ph << sizeLog2) >> 16; // 16-bit fraction
+
+        int32_t s1 = table[index];
+        int32_t s2 = table[(index + 1) & mask]; // wrap at table size
+
+        return InterpLerp::Blend(s1, s2, r) >> 4;
+    }
+
 public:
     // Virtual function to be overridden by derived classes
     virtual void __not_in_flash_func(compute)(uint32_t ph, int32_t mod1, int32_t mod2, int32_t *out) = 0;
+
+    // Render n samples in one call, so virtual dispatch and per-sample
+    // setup (grow clamping, rotation step) are paid once per block rather
+    // than once per sample. Derived classes should override this and hoist
+    // their setup; the default just loops over compute().
+    virtual void __not_in_flash_func(computeBlock)(const uint32_t *phases, int32_t mod1, int32_t mod2, int32_t (*out)[2], int n)
+    {
+        for (int i = 0; i < n; i++)
+            compute(phases[i], mod1, mod2, out[i]);
+    }
+
     virtual ~Oscillator() = default;
 };
 
+// Signature of a devirtualized block-render entry point
+using ComputeBlockFn = void (*)(Oscillator *self, const uint32_t *phases, int32_t mod1, int32_t mod2, int32_t (*out)[2], int n);
+
+// Trampoline binding computeBlock of a concrete oscillator type at
+// compile time: the qualified call below is non-virtual, so the body can
+// be inlined into the trampoline. Trampolines live in SRAM and pointers
+// to them sit in RAM-resident bank tables, so the per-block dispatch
+// never loads a vtable from flash.
+template <typename T>
+void __not_in_flash_func(computeBlockThunk)(Oscillator *self, const uint32_t *phases, int32_t mod1, int32_t mod2, int32_t (*out)[2], int n)
+{
+    static_cast<T *>(self)->T::computeBlock(phases, mod1, mod2, out, n);
+}
+
 /// Derived oscillator classes
 
 /// OSC Bank 1 - Function defined shapes
@@ -53,20 +271,26 @@ class YinYang : public Oscillator
     // rotation phase accumulator
     uint32_t ph_rot = 0;
 
-public:
-    void __not_in_flash_func(compute)(uint32_t ph, int32_t mod_grow, int32_t mod_rot, int32_t *out) override
-    {
-        // increment rotation phase
-        ph_rot += mod_rot - 2048 << 11;
-
-        // clamp grow factor
-        uint32_t grow = (uint32_t)(mod_grow < 0 ? 0 : (mod_grow > 4096 ? 4096 : mod_grow)) << 20;
+    // sign/section of the previous sample, to blank the streak the
+    // beam draws when it jumps between shape sections
+    uint32_t lastSec = 0;
 
+    // One sample of the figure, grow already clamped and widened,
+    // rotation sin/cos supplied by the caller
+    inline void __not_in_flash_func(sample)(uint32_t ph, uint32_t grow, int32_t s, int32_t c, int32_t *out)
+    {
         // prepare sign and phase for both yin and yang
         int32_t sign = ph >> 31 ? -1 : 1;                                // sign bit
-        uint32_t ph_all = (uint32_t)(((uint64_t)(ph * 2) * grow) >> 32); // phase scaled by grow factor
+        uint32_t ph_all = FixedPoint::MulHi(ph * 2, grow); // phase scaled by grow factor
 
         uint32_t sec = ph_all >> 30; // extract 2 MSB for section
+
+        // blank the one sample that jumps between sections (yin/yang
+        // flip and the body/eye boundary)
+        uint32_t secId = ((ph >> 31) << 2) | sec;
+        zCur = secId == lastSec ? BEAM_ON : 0;
+        lastSec = secId;
+
         if (sec == 3)                // 0b11 : eye section, last 1/8 of cycle
         {
             // eye section, single arc
@@ -77,7 +301,7 @@ public:
         else
         {
             // body section, 3 parts of 3 arcs
-            uint32_t ph_body = (uint32_t)(((uint64_t)ph_all * 0x55555556u) >> 30);
+            uint32_t ph_body = (FixedPoint::MulHi(ph_all, 0x55555556u) << 2) | (ph_all * 0x55555556u >> 30);
             uint32_t sec_body = ph_body >> 30;
             switch (sec_body)
             {
@@ -97,50 +321,86 @@ public:
             }
         }
 
-        int64_t x = sign * out[0];
-        int64_t y = sign * (out[1] + 8);
+        int32_t x = sign * out[0];
+        int32_t y = sign * (out[1] + 8);
 
         // apply rotation
-        int32_t s = sine(ph_rot);
-        int32_t c = sine(ph_rot + 0x40000000);
+        out[0] = (x * s + y * c) >> 11;
+        out[1] = (x * c - y * s) >> 11;
+    }
 
-        out[0] = (int32_t)((x * s + y * c) >> 11);
-        out[1] = (int32_t)((x * c - y * s) >> 11);
+public:
+    YinYang() { zSupported = true; }
+
+    void __not_in_flash_func(compute)(uint32_t ph, int32_t mod_grow, int32_t mod_rot, int32_t *out) override
+    {
+        // increment rotation phase
+        ph_rot += mod_rot - 2048 << 11;
+        int32_t s, c;
+        sincos(ph_rot, s, c);
+        sample(ph, growFactor(mod_grow), s, c, out);
+    }
+
+    void __not_in_flash_func(computeBlock)(const uint32_t *phases, int32_t mod_grow, int32_t mod_rot, int32_t (*out)[2], int n) override
+    {
+        // clamp grow factor and rotation matrix once per block
+        uint32_t grow = growFactor(mod_grow);
+        uint32_t rot_step = mod_rot - 2048 << 11;
+        RotState rot;
+        rotSeed(rot, ph_rot + rot_step, rot_step);
+        for (int i = 0; i < n; i++)
+        {
+            sample(phases[i], grow, rot.s, rot.c, out[i]);
+            if (zBuf)
+                zBuf[i] = zCur;
+            rotAdvance(rot);
+        }
+        ph_rot += rot_step * (uint32_t)n;
     }
 };
 
 /// OSC Bank 2 - Mesh geometry shapes
 
 // Polygon Waveform Oscillator
-class PolyCube : public Oscillator
+//
+// PATH and N are compile-time constants, so the segment multiply and
+// the (segment + 1) % N wrap fold into shifts and immediates instead
+// of a runtime reciprocal and modulo. Adding a mesh is one template
+// instantiation with zero new per-sample cost.
+template <const Point3D *PATH, uint32_t N>
+class PolyMesh : public Oscillator
 {
-    const Point3D *path = CUBE_PATH;
-    const uint32_t path_count = CUBE_PATH_COUNT;
     uint32_t ph_rot = 0;
 
-public:
-    void __not_in_flash_func(compute)(uint32_t ph, int32_t mod_grow, int32_t mod_rot, int32_t *out) override
+    // Segments whose edge already appeared earlier in the path retrace
+    // an existing line (the cube path revisits vertices on its way
+    // round); blanking the second pass keeps edge brightness even
+    uint64_t retrace = 0;
+
+    static bool samePoint(const Point3D &a, const Point3D &b)
     {
-        // clamp grow factor
-        uint32_t grow = (uint32_t)(mod_grow < 0 ? 0 : (mod_grow > 4096 ? 4096 : mod_grow)) << 20;
-        ph = (uint32_t)(((uint64_t)ph * grow) >> 32);
+        return a.x == b.x && a.y == b.y && a.z == b.z;
+    }
 
-        ph_rot += mod_rot - 2048 << 10;
+    inline void __not_in_flash_func(sample)(uint32_t ph, uint32_t grow, int32_t s, int32_t c, int32_t *out)
+    {
+        ph = FixedPoint::MulHi(ph, grow);
 
-        // interpolate position along cube path
-        uint32_t segment = ((uint64_t)ph * (path_count - 1)) >> 32;
-        uint16_t frac = (uint16_t)(((uint64_t)ph * (path_count - 1) & 0xFFFFFFFF) >> 22);
+        // interpolate position along the mesh path
+        uint32_t segment = FixedPoint::MulHi(ph, N - 1);
+        uint16_t frac = (uint16_t)(ph * (N - 1) >> 22);
 
-        Point3D p1 = path[segment];
-        Point3D p2 = path[(segment + 1) % path_count];
+        Point3D p1 = PATH[segment];
+        Point3D p2 = PATH[(segment + 1) % N];
+
+        zCur = (retrace >> segment) & 1 ? 0 : BEAM_ON;
 
         int32_t x = p1.x + (((p2.x - p1.x) * (int32_t)frac) >> 10);
         int32_t y = p1.y + (((p2.y - p1.y) * (int32_t)frac) >> 10);
         int32_t z = p1.z + (((p2.z - p1.z) * (int32_t)frac) >> 10);
 
         // apply rotation
-        int32_t s = sine(ph_rot);
-        int32_t c = sine(ph_rot - 0x40000000);
+        c = -c; // path convention rotates with sin(ph - pi/2)
 
         int32_t rx = int(x * c - z * s) >> 11;
         int32_t ry = y;
@@ -153,37 +413,143 @@ public:
         out[0] = u >> 1; // Scale to fit your specific output range
         out[1] = v >> 1;
     }
+
+public:
+    PolyMesh()
+    {
+        // Mark segments whose edge was already drawn earlier in the
+        // path (either direction). One-off O(N^2) at construction;
+        // segments past 64 would need a wider mask, but the expanded
+        // meshes stay well under that.
+        for (uint32_t i = 0; i + 1 < N && i < 64; i++)
+            for (uint32_t j = 0; j < i; j++)
+                if ((samePoint(PATH[i], PATH[j]) && samePoint(PATH[i + 1], PATH[j + 1])) ||
+                    (samePoint(PATH[i], PATH[j + 1]) && samePoint(PATH[i + 1], PATH[j])))
+                {
+                    retrace |= 1ull << i;
+                    break;
+                }
+        zSupported = true;
+    }
+
+    void __not_in_flash_func(compute)(uint32_t ph, int32_t mod_grow, int32_t mod_rot, int32_t *out) override
+    {
+        ph_rot += mod_rot - 2048 << 10;
+        int32_t s, c;
+        sincos(ph_rot, s, c);
+        sample(ph, growFactor(mod_grow), s, c, out);
+    }
+
+    void __not_in_flash_func(computeBlock)(const uint32_t *phases, int32_t mod_grow, int32_t mod_rot, int32_t (*out)[2], int n) override
+    {
+        uint32_t grow = growFactor(mod_grow);
+        uint32_t rot_step = mod_rot - 2048 << 10;
+        RotState rot;
+        rotSeed(rot, ph_rot + rot_step, rot_step);
+        for (int i = 0; i < n; i++)
+        {
+            sample(phases[i], grow, rot.s, rot.c, out[i]);
+            if (zBuf)
+                zBuf[i] = zCur;
+            rotAdvance(rot);
+        }
+        ph_rot += rot_step * (uint32_t)n;
+    }
 };
 
-class PolyCone : public Oscillator
+using PolyCube = PolyMesh<CUBE_PATH, CUBE_PATH_COUNT>;
+using PolyCone = PolyMesh<CONE_PATH, CONE_PATH_COUNT>;
+using PolyICO = PolyMesh<ICOSPHERE_PATH, ICOSPHERE_PATH_COUNT>;
+
+// Delta-decoded mesh oscillator: same interpolation, rotation and
+// projection as PolyMesh, but reads a delta-encoded path (DeltaMeshPath
+// in mesh_data.h) through a small RAM decode window instead of an
+// expanded Point3D array. Playback phase advances monotonically, so the
+// window normally steps at most one segment forward per sample;
+// backward jumps (grow slew, phase wrap) re-seek from the nearest
+// checkpoint. Meshes up to 4096 points are supported.
+class DeltaMesh : public Oscillator
 {
-    const Point3D *path = CONE_PATH;
-    const uint32_t path_count = CONE_PATH_COUNT;
+    const DeltaMeshPath *path;
     uint32_t ph_rot = 0;
 
-public:
-    void __not_in_flash_func(compute)(uint32_t ph, int32_t mod_grow, int32_t mod_rot, int32_t *out) override
+    // Decode window: p1/p2 are the current segment endpoints, streamPos
+    // the byte offset of the next encoded point
+    uint32_t seg = 0;
+    uint32_t streamPos = 0;
+    Point3D p1 = {0, 0, 0}, p2 = {0, 0, 0};
+
+    // Checkpoints every 64 points bound the cost of a backward seek
+    static constexpr int CHECK_SHIFT = 6;
+    static constexpr uint32_t MAX_CHECKPOINTS = 64;
+    struct Checkpoint
     {
-        // clamp grow factor
-        uint32_t grow = (uint32_t)(mod_grow < 0 ? 0 : (mod_grow > 4096 ? 4096 : mod_grow)) << 20;
-        ph = (uint32_t)(((uint64_t)ph * grow) >> 32);
+        uint32_t offset; // stream offset of the point after this one
+        Point3D p;
+    };
+    Checkpoint checks[MAX_CHECKPOINTS];
 
-        ph_rot += mod_rot - 2048 << 10;
+    static int16_t __not_in_flash_func(decodeAxis)(const uint8_t *d, uint32_t &pos, int16_t prev)
+    {
+        int8_t b = (int8_t)d[pos++];
+        if (b != -128)
+            return prev + b;
+        int16_t v = (int16_t)(d[pos] | (d[pos + 1] << 8));
+        pos += 2;
+        return v;
+    }
 
-        // interpolate position along cube path
-        uint32_t segment = ((uint64_t)ph * (path_count - 1)) >> 32;
-        uint16_t frac = (uint16_t)(((uint64_t)ph * (path_count - 1) & 0xFFFFFFFF) >> 22);
+    // Decode the next point; p carries the previous point in and the
+    // decoded one out
+    void __not_in_flash_func(decodePoint)(uint32_t &pos, Point3D &p) const
+    {
+        const uint8_t *d = path->data;
+        p.x = decodeAxis(d, pos, p.x);
+        p.y = decodeAxis(d, pos, p.y);
+        p.z = decodeAxis(d, pos, p.z);
+    }
 
-        Point3D p1 = path[segment];
-        Point3D p2 = path[(segment + 1) % path_count];
+    void __not_in_flash_func(advance)()
+    {
+        p1 = p2;
+        decodePoint(streamPos, p2);
+        seg++;
+    }
+
+    // Rewind the window to the start of checkpoint c's stretch
+    void __not_in_flash_func(restore)(uint32_t c)
+    {
+        seg = c << CHECK_SHIFT;
+        streamPos = checks[c].offset;
+        p1 = checks[c].p;
+        p2 = p1;
+        decodePoint(streamPos, p2);
+    }
+
+    void __not_in_flash_func(seekSegment)(uint32_t target)
+    {
+        if (target < seg)
+            restore(target >> CHECK_SHIFT);
+        while (seg < target)
+            advance();
+    }
+
+    inline void __not_in_flash_func(sample)(uint32_t ph, uint32_t grow, int32_t s, int32_t c, int32_t *out)
+    {
+        ph = FixedPoint::MulHi(ph, grow);
+
+        // interpolate position along the mesh path
+        uint32_t segment = FixedPoint::MulHi(ph, path->count - 1);
+        uint16_t frac = (uint16_t)(ph * (path->count - 1) >> 22);
+
+        seekSegment(segment);
 
         int32_t x = p1.x + (((p2.x - p1.x) * (int32_t)frac) >> 10);
         int32_t y = p1.y + (((p2.y - p1.y) * (int32_t)frac) >> 10);
         int32_t z = p1.z + (((p2.z - p1.z) * (int32_t)frac) >> 10);
 
         // apply rotation
-        int32_t s = sine(ph_rot);
-        int32_t c = sine(ph_rot - 0x40000000);
+        c = -c; // path convention rotates with sin(ph - pi/2)
 
         int32_t rx = int(x * c - z * s) >> 11;
         int32_t ry = y;
@@ -193,164 +559,362 @@ public:
         int32_t u = rx;
         int32_t v = (rz >> 1) + ((ry * 3547) >> 12);
 
-        out[0] = u >> 1; // Scale to fit your specific output range
+        out[0] = u >> 1;
         out[1] = v >> 1;
     }
-};
 
-class PolyICO : public Oscillator
-{
-    const Point3D *path = ICOSPHERE_PATH;
-    const uint32_t path_count = ICOSPHERE_PATH_COUNT;
+public:
+    DeltaMesh(const DeltaMeshPath *p) : path(p)
+    {
+        // Walk the stream once, recording a checkpoint every 64 points
+        uint32_t pos = 0;
+        Point3D pt = {0, 0, 0};
+        for (uint32_t i = 0; i < path->count; i++)
+        {
+            decodePoint(pos, pt);
+            if ((i & ((1u << CHECK_SHIFT) - 1)) == 0)
+                checks[i >> CHECK_SHIFT] = {pos, pt};
+        }
+        restore(0);
+    }
 
-    uint32_t ph_rot = 0;
+    void __not_in_flash_func(compute)(uint32_t ph, int32_t mod_grow, int32_t mod_rot, int32_t *out) override
+    {
+        ph_rot += mod_rot - 2048 << 10;
+        int32_t s, c;
+        sincos(ph_rot, s, c);
+        sample(ph, growFactor(mod_grow), s, c, out);
+    }
 
+    void __not_in_flash_func(computeBlock)(const uint32_t *phases, int32_t mod_grow, int32_t mod_rot, int32_t (*out)[2], int n) override
+    {
+        uint32_t grow = growFactor(mod_grow);
+        uint32_t rot_step = mod_rot - 2048 << 10;
+        RotState rot;
+        rotSeed(rot, ph_rot + rot_step, rot_step);
+        for (int i = 0; i < n; i++)
+        {
+            sample(phases[i], grow, rot.s, rot.c, out[i]);
+            rotAdvance(rot);
+        }
+        ph_rot += rot_step * (uint32_t)n;
+    }
+};
+
+// Catmull-Rom mesh oscillator: curved shapes from sparse control
+// points, so round meshes no longer need dense linear sampling (~4x
+// fewer stored vertices at equal smoothness). The cubic coefficients
+// for every segment are precomputed once at construction into a
+// caller-provided RAM block, so the per-sample cost is one Horner
+// evaluation per axis on the cached segment instead of fetching four
+// control points and doing the basis math.
+class SplineMesh : public Oscillator
+{
 public:
-    void __not_in_flash_func(compute)(uint32_t ph, int32_t mod_grow, int32_t mod_rot, int32_t *out) override
+    // Doubled Catmull-Rom coefficients for one segment (the 1/2
+    // factors in the basis make the doubled forms exact integers);
+    // sample() halves after the Horner chain. 48 bytes per segment.
+    struct Coef
     {
-        // clamp grow factor
-        uint32_t grow = (uint32_t)(mod_grow < 0 ? 0 : (mod_grow > 4096 ? 4096 : mod_grow)) << 20;
-        ph = (uint32_t)(((uint64_t)ph * grow) >> 32);
+        int32_t a[3], b[3], c[3], d[3];
+    };
 
-        ph_rot += mod_rot - 2048 << 10;
+private:
+    const Coef *coef;
+    uint32_t segments;
+    uint32_t ph_rot = 0;
 
-        // interpolate position along cube path
-        uint32_t segment = ((uint64_t)ph * (path_count - 1)) >> 32;
-        uint16_t frac = (uint16_t)(((uint64_t)ph * (path_count - 1) & 0xFFFFFFFF) >> 22);
+    inline void __not_in_flash_func(sample)(uint32_t ph, uint32_t grow, int32_t s, int32_t c, int32_t *out)
+    {
+        ph = FixedPoint::MulHi(ph, grow);
 
-        Point3D p1 = path[segment];
-        Point3D p2 = path[(segment + 1) % path_count];
+        uint32_t segment = FixedPoint::MulHi(ph, segments);
+        int32_t t = (int32_t)(ph * segments >> 22); // 10-bit fraction, like the linear path
 
-        int32_t x = p1.x + (((p2.x - p1.x) * (int32_t)frac) >> 10);
-        int32_t y = p1.y + (((p2.y - p1.y) * (int32_t)frac) >> 10);
-        int32_t z = p1.z + (((p2.z - p1.z) * (int32_t)frac) >> 10);
+        const Coef &k = coef[segment];
+        int32_t x = (k.a[0] + (t * (k.b[0] + (t * (k.c[0] + (t * k.d[0] >> 10)) >> 10)) >> 10)) >> 1;
+        int32_t y = (k.a[1] + (t * (k.b[1] + (t * (k.c[1] + (t * k.d[1] >> 10)) >> 10)) >> 10)) >> 1;
+        int32_t z = (k.a[2] + (t * (k.b[2] + (t * (k.c[2] + (t * k.d[2] >> 10)) >> 10)) >> 10)) >> 1;
 
-        // apply rotation
-        int32_t s = sine(ph_rot);
-        int32_t c = sine(ph_rot - 0x40000000);
+        // rotation and projection as PolyMesh
+        c = -c;
 
-        int32_t rx = int(x * c - z * s) >> 11;
+        int32_t rx = (x * c - z * s) >> 11;
         int32_t ry = y;
         int32_t rz = (x * s + z * c) >> 11;
 
-        // isometric projection, 30 degrees
         int32_t u = rx;
         int32_t v = (rz >> 1) + ((ry * 3547) >> 12);
 
-        out[0] = u >> 1; // Scale to fit your specific output range
+        out[0] = u >> 1;
         out[1] = v >> 1;
     }
+
+public:
+    // Precompute doubled coefficients from the control path. The path
+    // is treated as a closed tour: neighbours wrap, and segment count
+    // matches the linear convention (n - 1 segments over one cycle).
+    // coefBuf must hold n - 1 entries and stay alive with the instance.
+    SplineMesh(const Point3D *path, uint32_t n, Coef *coefBuf)
+        : coef(coefBuf), segments(n - 1)
+    {
+        for (uint32_t i = 0; i < segments; i++)
+        {
+            const Point3D &p0 = path[(i + n - 1) % n];
+            const Point3D &p1 = path[i];
+            const Point3D &p2 = path[(i + 1) % n];
+            const Point3D &p3 = path[(i + 2) % n];
+            const int16_t *q[4] = {&p0.x, &p1.x, &p2.x, &p3.x};
+            for (int ax = 0; ax < 3; ax++)
+            {
+                int32_t v0 = q[0][ax], v1 = q[1][ax], v2 = q[2][ax], v3 = q[3][ax];
+                coefBuf[i].a[ax] = 2 * v1;
+                coefBuf[i].b[ax] = v2 - v0;
+                coefBuf[i].c[ax] = 2 * v0 - 5 * v1 + 4 * v2 - v3;
+                coefBuf[i].d[ax] = -v0 + 3 * v1 - 3 * v2 + v3;
+            }
+        }
+    }
+
+    void __not_in_flash_func(compute)(uint32_t ph, int32_t mod_grow, int32_t mod_rot, int32_t *out) override
+    {
+        ph_rot += mod_rot - 2048 << 10;
+        int32_t s, c;
+        sincos(ph_rot, s, c);
+        sample(ph, growFactor(mod_grow), s, c, out);
+    }
+
+    void __not_in_flash_func(computeBlock)(const uint32_t *phases, int32_t mod_grow, int32_t mod_rot, int32_t (*out)[2], int n) override
+    {
+        uint32_t grow = growFactor(mod_grow);
+        uint32_t rot_step = mod_rot - 2048 << 10;
+        RotState rot;
+        rotSeed(rot, ph_rot + rot_step, rot_step);
+        for (int i = 0; i < n; i++)
+        {
+            sample(phases[i], grow, rot.s, rot.c, out[i]);
+            rotAdvance(rot);
+        }
+        ph_rot += rot_step * (uint32_t)n;
+    }
 };
 
 /// OSC Bank 3 - Wavetable shapes (single cycle stereo samples from vector graphics)
 
 class YinYangCalligraphy : public Oscillator
 {
-    const StereoTable *YIN = &YIN_TABLE;
-    const StereoTable *YANG = &YANG_TABLE;
+    const StereoTableMip *YIN = &TableRam::Yin;
+    const StereoTableMip *YANG = &TableRam::Yang;
 
-public:
-    void __not_in_flash_func(compute)(uint32_t ph, int32_t mod_grow, int32_t mod_morph, int32_t *out) override
+    inline void __not_in_flash_func(sample)(uint32_t ph, uint32_t grow, uint32_t morph,
+                                            const int16_t *yin_l_t, const int16_t *yin_r_t,
+                                            const int16_t *yang_l_t, const int16_t *yang_r_t,
+                                            int sizeLog2, int32_t *out)
     {
-        uint32_t grow = (uint32_t)(mod_grow < 0 ? 0 : (mod_grow > 4096 ? 4096 : mod_grow)) << 20;
-        ph = (uint32_t)(((uint64_t)ph * grow) >> 32);
-
-        uint32_t morph = (uint32_t)(mod_morph < 0 ? 0 : (mod_morph > 4096 ? 4096 : mod_morph)) << 20;
+        ph = FixedPoint::MulHi(ph, grow);
 
-        int32_t yin_l = lookup1024(ph, YIN->left);
-        int32_t yin_r = lookup1024(ph, YIN->right);
-        int32_t yang_l = lookup1024(ph, YANG->left);
-        int32_t yang_r = lookup1024(ph, YANG->right);
+        int32_t yin_l = lookupMip(ph, yin_l_t, sizeLog2);
+        int32_t yin_r = lookupMip(ph, yin_r_t, sizeLog2);
+        int32_t yang_l = lookupMip(ph, yang_l_t, sizeLog2);
+        int32_t yang_r = lookupMip(ph, yang_r_t, sizeLog2);
 
         out[0] = (yin_l * (int32_t)(65536 - (morph >> 16)) + yang_l * (int32_t)(morph >> 16)) * 6 >> 19; // scale 6/8
         out[1] = -(yin_r * (int32_t)(65536 - (morph >> 16)) + yang_r * (int32_t)(morph >> 16)) * 6 >> 19;
     }
 
-protected:
-    // ph: 32-bit
-    // table: int16_t[1024]
-    inline int32_t __not_in_flash_func(lookup1024)(uint32_t ph, const int16_t *table)
+public:
+    void __not_in_flash_func(compute)(uint32_t ph, int32_t mod_grow, int32_t mod_morph, int32_t *out) override
     {
-        // 10-bit index for 1024 entries
-        uint32_t index = ph >> 22; // top 10 bits -> [0, 1023]
-        // 22-bit fractional part -> convert to 16-bit fraction
-        uint32_t r = (ph & 0x003FFFFF) >> 6; // keep upper 16 bits of fraction
-
-        int32_t s1 = table[index];
-        int32_t s2 = table[(index + 1) & 0x3FF]; // wrap at 1024
+        sample(ph, growFactor(mod_grow), growFactor(mod_morph),
+               YIN->Left(0), YIN->Right(0), YANG->Left(0), YANG->Right(0), 10, out);
+    }
 
-        // Linear interpolation: ((s2 - s1) * r >> 16) + s1
-        return (s2 * (int32_t)r + s1 * (int32_t)(65536 - r)) >> 20;
+    void __not_in_flash_func(computeBlock)(const uint32_t *phases, int32_t mod_grow, int32_t mod_morph, int32_t (*out)[2], int n) override
+    {
+        uint32_t grow = growFactor(mod_grow);
+        uint32_t morph = growFactor(mod_morph);
+
+        // select band-limited level from the block's phase increment
+        int lvl = mipLevel(n > 1 ? phases[1] - phases[0] : 0);
+        int sizeLog2 = 10 - lvl;
+        const int16_t *yin_l_t = YIN->Left(lvl);
+        const int16_t *yin_r_t = YIN->Right(lvl);
+        const int16_t *yang_l_t = YANG->Left(lvl);
+        const int16_t *yang_r_t = YANG->Right(lvl);
+
+        for (int i = 0; i < n; i++)
+            sample(phases[i], grow, morph, yin_l_t, yin_r_t, yang_l_t, yang_r_t, sizeLog2, out[i]);
     }
 };
 
 class RibbonWC : public Oscillator
 {
-    const StereoTable *RIBBON = &RIBBON_TABLE;
+    const StereoTableMip *RIBBON = &TableRam::Ribbon;
 
-public:
-    void __not_in_flash_func(compute)(uint32_t ph, int32_t mod_grow, int32_t mod_stretch, int32_t *out) override
+    inline void __not_in_flash_func(sample)(uint32_t ph, uint32_t grow, int32_t mod_stretch,
+                                            const int16_t *left_t, const int16_t *right_t,
+                                            int sizeLog2, int32_t *out)
     {
-        uint32_t grow = (uint32_t)(mod_grow < 0 ? 0 : (mod_grow > 4096 ? 4096 : mod_grow)) << 20;
-        ph = (uint32_t)(((uint64_t)ph * grow) >> 32);
+        ph = FixedPoint::MulHi(ph, grow);
 
-        int32_t ribbon_l = lookup1024(ph, RIBBON->left);
-        int32_t ribbon_r = lookup1024(ph, RIBBON->right) * (mod_stretch - 2048) >> 11;
+        int32_t ribbon_l = lookupMip(ph, left_t, sizeLog2);
+        int32_t ribbon_r = lookupMip(ph, right_t, sizeLog2) * (mod_stretch - 2048) >> 11;
 
         out[0] = ribbon_l * 6 >> 3; // scale 6/8
         out[1] = ribbon_r * 6 >> 3;
     }
 
-protected:
-    // ph: 32-bit
-    // table: int16_t[1024]
-    inline int32_t __not_in_flash_func(lookup1024)(uint32_t ph, const int16_t *table)
+public:
+    void __not_in_flash_func(compute)(uint32_t ph, int32_t mod_grow, int32_t mod_stretch, int32_t *out) override
     {
-        // 10-bit index for 1024 entries
-        uint32_t index = ph >> 22; // top 10 bits -> [0, 1023]
-        // 22-bit fractional part -> convert to 16-bit fraction
-        uint32_t r = (ph & 0x003FFFFF) >> 6; // keep upper 16 bits of fraction
+        sample(ph, growFactor(mod_grow), mod_stretch, RIBBON->Left(0), RIBBON->Right(0), 10, out);
+    }
 
-        int32_t s1 = table[index];
-        int32_t s2 = table[(index + 1) & 0x3FF]; // wrap at 1024
+    void __not_in_flash_func(computeBlock)(const uint32_t *phases, int32_t mod_grow, int32_t mod_stretch, int32_t (*out)[2], int n) override
+    {
+        uint32_t grow = growFactor(mod_grow);
+
+        int lvl = mipLevel(n > 1 ? phases[1] - phases[0] : 0);
+        int sizeLog2 = 10 - lvl;
+        const int16_t *left_t = RIBBON->Left(lvl);
+        const int16_t *right_t = RIBBON->Right(lvl);
 
-        // Linear interpolation: ((s2 - s1) * r >> 16) + s1
-        return (s2 * (int32_t)r + s1 * (int32_t)(65536 - r)) >> 20;
+        for (int i = 0; i < n; i++)
+            sample(phases[i], grow, mod_stretch, left_t, right_t, sizeLog2, out[i]);
     }
 };
 
 
 class OutlineWC : public Oscillator
 {
-    const StereoTable *OUTLINE = &OUTLINE_TABLE;
+    const StereoTableMip *OUTLINE = &TableRam::Outline;
 
 public:
-    void __not_in_flash_func(compute)(uint32_t ph, int32_t mod_grow, int32_t mod_stretch, int32_t *out) override
+    OutlineWC() = default;
+    // Same rendering over a different table, e.g. a registry-loaded slot
+    explicit OutlineWC(const StereoTableMip *table) : OUTLINE(table) {}
+
+private:
+
+    inline void __not_in_flash_func(sample)(uint32_t ph, uint32_t grow,
+                                            const int16_t *left_t, const int16_t *right_t,
+                                            int sizeLog2, int32_t *out)
     {
-        uint32_t grow = (uint32_t)(mod_grow < 0 ? 0 : (mod_grow > 4096 ? 4096 : mod_grow)) << 20;
-        ph = (uint32_t)(((uint64_t)ph * grow) >> 32);
+        ph = FixedPoint::MulHi(ph, grow);
 
-        int32_t outline_l = lookup1024(ph, OUTLINE->left);
-        int32_t outline_r = lookup1024(ph, OUTLINE->right);
+        int32_t outline_l = lookupMip(ph, left_t, sizeLog2);
+        int32_t outline_r = lookupMip(ph, right_t, sizeLog2);
 
         out[0] = outline_l * 6 >> 3; // scale 6/8
         out[1] = outline_r * 6 >> 3;
     }
 
-protected:
-    // ph: 32-bit
-    // table: int16_t[1024]
-    inline int32_t __not_in_flash_func(lookup1024)(uint32_t ph, const int16_t *table)
+public:
+    void __not_in_flash_func(compute)(uint32_t ph, int32_t mod_grow, int32_t mod_stretch, int32_t *out) override
     {
-        // 10-bit index for 1024 entries
-        uint32_t index = ph >> 22; // top 10 bits -> [0, 1023]
-        // 22-bit fractional part -> convert to 16-bit fraction
-        uint32_t r = (ph & 0x003FFFFF) >> 6; // keep upper 16 bits of fraction
+        sample(ph, growFactor(mod_grow), OUTLINE->Left(0), OUTLINE->Right(0), 10, out);
+    }
 
-        int32_t s1 = table[index];
-        int32_t s2 = table[(index + 1) & 0x3FF]; // wrap at 1024
+    void __not_in_flash_func(computeBlock)(const uint32_t *phases, int32_t mod_grow, int32_t mod_stretch, int32_t (*out)[2], int n) override
+    {
+        uint32_t grow = growFactor(mod_grow);
+
+        int lvl = mipLevel(n > 1 ? phases[1] - phases[0] : 0);
+        int sizeLog2 = 10 - lvl;
+        const int16_t *left_t = OUTLINE->Left(lvl);
+        const int16_t *right_t = OUTLINE->Right(lvl);
+
+        for (int i = 0; i < n; i++)
+            sample(phases[i], grow, left_t, right_t, sizeLog2, out[i]);
+    }
+};
+
+// N-table wavetable morph engine. The morph control scans a list of
+// stereo mip tables and each sample blends the two either side of the
+// morph position, so the per-sample cost does not grow with the list.
+// The index/fraction split is extracted once per sample and shared by
+// all four table fetches (YinYangCalligraphy redoes it per channel),
+// and both channels of the pair read through pointers pre-offset to
+// the block's mip level. Defaults to the Yin/Yang pair; registry-
+// loaded slots extend the list at boot or after an upload.
+class MorphWC : public Oscillator
+{
+public:
+    static constexpr int MAX_TABLES = 4;
+
+private:
+    const StereoTableMip *tables[MAX_TABLES] = {&TableRam::Yin, &TableRam::Yang};
+    int numTables = 2;
+
+    inline void __not_in_flash_func(sample)(uint32_t ph, uint32_t grow, uint32_t mix,
+                                            const int16_t *la, const int16_t *ra,
+                                            const int16_t *lb, const int16_t *rb,
+                                            int sizeLog2, int32_t *out)
+    {
+        ph = FixedPoint::MulHi(ph, grow);
+
+        // index and fraction once, shared by all four fetches
+        uint32_t index = ph >> (32 - sizeLog2);
+        uint32_t next = (index + 1) & ((1u << sizeLog2) - 1);
+        uint32_t r = (uint32_t)(ph << sizeLog2) >> 16;
+
+        int32_t a_l = InterpLerp::Blend(la[index], la[next], r) >> 4;
+        int32_t a_r = InterpLerp::Blend(ra[index], ra[next], r) >> 4;
+        int32_t b_l = InterpLerp::Blend(lb[index], lb[next], r) >> 4;
+        int32_t b_r = InterpLerp::Blend(rb[index], rb[next], r) >> 4;
+
+        int32_t inv = 65536 - (int32_t)mix;
+        out[0] = (a_l * inv + b_l * (int32_t)mix) * 6 >> 19; // scale 6/8
+        out[1] = (a_r * inv + b_r * (int32_t)mix) * 6 >> 19;
+    }
+
+    // Split the morph position into the table pair below it and a
+    // 16-bit mix between the two. With two tables this reduces to the
+    // YinYangCalligraphy mapping (pair 0, mix = morph >> 16).
+    inline void __not_in_flash_func(morphPair)(uint32_t morph, uint32_t &k, uint32_t &mix)
+    {
+        uint32_t span = (uint32_t)(numTables - 1);
+        k = FixedPoint::MulHi(morph, span);
+        mix = (morph * span) >> 16;
+    }
+
+public:
+    // Append a table to the morph list; ignores duplicates so a
+    // registry re-upload does not grow the list
+    bool AddTable(const StereoTableMip *t)
+    {
+        for (int i = 0; i < numTables; i++)
+            if (tables[i] == t)
+                return true;
+        if (numTables == MAX_TABLES)
+            return false;
+        tables[numTables++] = t;
+        return true;
+    }
 
-        // Linear interpolation: ((s2 - s1) * r >> 16) + s1
-        return (s2 * (int32_t)r + s1 * (int32_t)(65536 - r)) >> 20;
+    void __not_in_flash_func(compute)(uint32_t ph, int32_t mod_grow, int32_t mod_morph, int32_t *out) override
+    {
+        uint32_t k, mix;
+        morphPair(growFactor(mod_morph), k, mix);
+        sample(ph, growFactor(mod_grow), mix,
+               tables[k]->Left(0), tables[k]->Right(0),
+               tables[k + 1]->Left(0), tables[k + 1]->Right(0), 10, out);
     }
-};
\ No newline at end of file
+
+    void __not_in_flash_func(computeBlock)(const uint32_t *phases, int32_t mod_grow, int32_t mod_morph, int32_t (*out)[2], int n) override
+    {
+        uint32_t grow = growFactor(mod_grow);
+        uint32_t k, mix;
+        morphPair(growFactor(mod_morph), k, mix);
+
+        int lvl = mipLevel(n > 1 ? phases[1] - phases[0] : 0);
+        int sizeLog2 = 10 - lvl;
+        const int16_t *la = tables[k]->Left(lvl);
+        const int16_t *ra = tables[k]->Right(lvl);
+        const int16_t *lb = tables[k + 1]->Left(lvl);
+        const int16_t *rb = tables[k + 1]->Right(lvl);
+
+        for (int i = 0; i < n; i++)
+            sample(phases[i], grow, mix, la, ra, lb, rb, sizeLog2, out[i]);
+    }
+};
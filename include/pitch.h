@@ -0,0 +1,126 @@
+#pragma once
+
+#include "ComputerCard.h"
+#include <cstdint>
+#include <cstring>
+
+// 1V/oct pitch engine.
+//
+// The old pitch path indexed KnobVal(Main) + CVIn1() straight into a
+// 4096-entry increment table, so CV tracking was fixed by the table
+// granularity and worked out near 0.5V/oct -- the README lists proper
+// 1V/oct calibration as an open problem. This engine computes the phase
+// increment with a fixed-point exp2 instead: a compile-time-generated
+// mantissa table covers one octave and the integer octave count becomes
+// a shift, so pitch resolution is 1/65536 octave (0.02 cents) from ~1KB
+// of table instead of 1/682 octave from 16KB.
+//
+// Scaling: the CV inputs read +-6V as +-2048 counts, so one count is
+// 6/2048 V = 3/1024 octave at 1V/oct, which is exactly 192 in Q16.
+// The EEPROM calibration ComputerCard loads covers the CV *outputs*
+// only -- there is no stored input calibration -- so the input gets a
+// settable trim around that schematic-derived default instead.
+//
+// The knob keeps its old feel: six octaves across the full travel,
+// bottom of the range at the same ~10Hz as entry 0 of the old table.
+
+// Table size is build-configurable: entries = 2^TRACE_PITCH_TABLE_LOG2
+// per octave (+1 so interpolation never wraps). The default 256-entry
+// table is ~1KB; -DTRACE_PITCH_TABLE_LOG2=7 halves it, the linear
+// interpolation below absorbing the coarser grid.
+#ifndef TRACE_PITCH_TABLE_LOG2
+#define TRACE_PITCH_TABLE_LOG2 8
+#endif
+
+namespace Pitch
+{
+    // Pitch values are Q16 octaves above the 10Hz bottom of the range
+    constexpr int32_t MAX_PITCH = 6 << 16;
+
+    // One Main-knob count = 6/4096 octave
+    constexpr int32_t KNOB_OCT_Q16 = 96;
+
+    // One CV count = 3/1024 octave at exactly 1V/oct
+    constexpr int32_t CV_OCT_Q16 = 192;
+
+    constexpr int TABLE_LOG2 = TRACE_PITCH_TABLE_LOG2;
+    constexpr int TABLE_SIZE = 1 << TABLE_LOG2;
+
+    // Phase increment at the bottom of the range (~10Hz at 48kHz)
+    constexpr int32_t BASE_INC = 894784;
+
+    // Compile-time exp2 via e^(f ln2), Taylor series in double: accurate
+    // to ~1 ulp, comfortably inside the 5e-4 rounding margin of the
+    // nearest table entry
+    constexpr double exp2Frac(double f)
+    {
+        double x = f * 0.69314718055994530942;
+        double term = 1.0, sum = 1.0;
+        for (int k = 1; k <= 20; k++)
+        {
+            term *= x / k;
+            sum += term;
+        }
+        return sum;
+    }
+
+    struct Exp2Table
+    {
+        int32_t v[TABLE_SIZE + 1];
+    };
+
+    // EXP2_INC[i] = round(BASE_INC * 2^(i/TABLE_SIZE)), octave 0 increments
+    constexpr Exp2Table makeExp2Table()
+    {
+        Exp2Table t{};
+        for (int i = 0; i <= TABLE_SIZE; i++)
+            t.v[i] = (int32_t)(BASE_INC * exp2Frac((double)i / TABLE_SIZE) + 0.5);
+        return t;
+    }
+
+    inline constexpr Exp2Table EXP2_INC = makeExp2Table();
+
+    // RAM copy, read at control rate from the audio ISR
+    inline int32_t Exp2Inc[TABLE_SIZE + 1];
+
+    // Per-card CV input trim: Q12 gain on the raw CV counts and a Q16
+    // octave offset, both applied before the exp2. Defaults are the
+    // uncalibrated schematic values.
+    inline int32_t cvScale = 4096;
+    inline int32_t cvOffset = 0;
+
+    inline void SetCVTrim(int32_t scaleQ12, int32_t offsetOctQ16)
+    {
+        cvScale = scaleQ12;
+        cvOffset = offsetOctQ16;
+    }
+
+    // Copy the mantissa table into SRAM. Call once at startup, before Run().
+    inline void Init()
+    {
+        memcpy(Exp2Inc, EXP2_INC.v, sizeof(Exp2Inc));
+    }
+
+    // Q16 octaves -> 32-bit phase increment, clamped to the six-octave window
+    inline int32_t __not_in_flash_func(Exp2)(int32_t pitch)
+    {
+        if (pitch < 0)
+            pitch = 0;
+        if (pitch > MAX_PITCH)
+            pitch = MAX_PITCH;
+        uint32_t oct = (uint32_t)pitch >> 16;
+        uint32_t frac = (uint32_t)pitch & 0xFFFF;
+        constexpr int fracBits = 16 - TABLE_LOG2;
+        uint32_t idx = frac >> fracBits;
+        int32_t m1 = Exp2Inc[idx];
+        int32_t d = Exp2Inc[idx + 1] - m1;
+        return (m1 + ((d * (int32_t)(frac & ((1u << fracBits) - 1))) >> fracBits)) << oct;
+    }
+
+    // Main knob + CV1 counts -> phase increment
+    inline int32_t __not_in_flash_func(Increment)(int32_t knob, int32_t cv)
+    {
+        int32_t cvAdj = (cv * cvScale) >> 12;
+        return Exp2(knob * KNOB_OCT_Q16 + cvAdj * CV_OCT_Q16 + cvOffset);
+    }
+}
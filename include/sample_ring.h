@@ -0,0 +1,60 @@
+#pragma once
+
+#include "ComputerCard.h"
+#include <cstdint>
+
+// One stereo output frame, as produced by Oscillator::computeBlock
+struct StereoFrame
+{
+    int32_t l;
+    int32_t r;
+};
+
+// Lock-free single-producer single-consumer ring of stereo frames.
+//
+// Used to hand pre-rendered samples from the core 1 render loop to the
+// core 0 audio ISR. No locks are needed: head is only written by the
+// producer, tail only by the consumer, and aligned 32-bit loads/stores
+// are atomic on the Cortex-M0+.
+template <uint32_t N> // must be a power of two
+class SampleRing
+{
+    static_assert((N & (N - 1)) == 0, "SampleRing size must be a power of two");
+
+    StereoFrame buffer[N];
+    volatile uint32_t head = 0; // written by producer only
+    volatile uint32_t tail = 0; // written by consumer only
+
+public:
+    // Number of frames the producer can push without overwriting
+    uint32_t __not_in_flash_func(Free)() const
+    {
+        return N - (head - tail);
+    }
+
+    // Number of frames ready for the consumer
+    uint32_t __not_in_flash_func(Count)() const
+    {
+        return head - tail;
+    }
+
+    // Producer side. Returns false (and drops the frame) when full.
+    bool __not_in_flash_func(Push)(const StereoFrame &f)
+    {
+        if (head - tail >= N)
+            return false;
+        buffer[head & (N - 1)] = f;
+        head = head + 1;
+        return true;
+    }
+
+    // Consumer side. Returns false when no frame is ready.
+    bool __not_in_flash_func(Pop)(StereoFrame &f)
+    {
+        if (head == tail)
+            return false;
+        f = buffer[tail & (N - 1)];
+        tail = tail + 1;
+        return true;
+    }
+};
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "ComputerCard.h"
+#include <cstdint>
+#include <cstring>
+#include "lookup_tables.h"
+
+// RAM copies of the hot lookup tables.
+//
+// The constexpr tables in lookup_tables.h live in flash, so every read
+// goes through the XIP cache and can stall the ISR when the cache is
+// under pressure from code fetches. Init() copies them into SRAM once
+// at startup and the oscillator lookup helpers read the RAM copies.
+//
+// Placement: the sine table goes in scratch X, which it fills exactly
+// alongside the 2KB core 1 stack reservation, so its fetches never
+// contend with the word-striped main SRAM banks. Scratch Y is left
+// alone - the core 0 stack reservation lives there and a mip pyramid
+// next to it would overflow the 4KB bank. The wavetable pyramids stay
+// in main SRAM, where the four-way word striping already spreads
+// concurrent ISR and render fetches.
+
+// Mipmapped RAM image of a StereoTable: level 0 is the full
+// 1024-sample table, each further level is half-band filtered to half
+// the length, so high-register playback can use a pre-band-limited
+// level instead of folding harmonics back over Nyquist.
+struct StereoTableMip
+{
+    static constexpr int levels = 4;                         // 1024/512/256/128
+    static constexpr int totalSize = 1024 + 512 + 256 + 128; // all levels packed
+    static constexpr uint16_t offsets[levels] = {0, 1024, 1536, 1792};
+
+    int16_t *left;  // totalSize entries
+    int16_t *right; // totalSize entries
+
+    const int16_t *Left(int lvl) const { return left + offsets[lvl]; }
+    const int16_t *Right(int lvl) const { return right + offsets[lvl]; }
+};
+
+namespace TableRam
+{
+    // 2KB sine table, scratch X bank
+    inline int32_t __scratch_x("trace_tables") Sine[512];
+
+    // polyBLEP/polyBLAMP residuals for the band-limited primitives.
+    // Only read within one sample of a discontinuity, so main SRAM.
+    inline int32_t Blep[65];
+    inline int32_t Blamp[65];
+
+    // Mip pyramid storage, 3.75KB per channel, all in main SRAM (a
+    // pyramid does not fit in a scratch bank beside a stack reservation)
+    inline int16_t YinLeftData[StereoTableMip::totalSize];
+    inline int16_t YinRightData[StereoTableMip::totalSize];
+    inline int16_t YangLeftData[StereoTableMip::totalSize];
+    inline int16_t YangRightData[StereoTableMip::totalSize];
+    inline int16_t RibbonLeftData[StereoTableMip::totalSize];
+    inline int16_t RibbonRightData[StereoTableMip::totalSize];
+    inline int16_t OutlineLeftData[StereoTableMip::totalSize];
+    inline int16_t OutlineRightData[StereoTableMip::totalSize];
+
+    // Spare slots for tables streamed in from the flash bank registry;
+    // the second one only feeds the morph list
+    inline int16_t UserLeftData[StereoTableMip::totalSize];
+    inline int16_t UserRightData[StereoTableMip::totalSize];
+    inline int16_t User2LeftData[StereoTableMip::totalSize];
+    inline int16_t User2RightData[StereoTableMip::totalSize];
+
+    inline StereoTableMip Yin = {YinLeftData, YinRightData};
+    inline StereoTableMip Yang = {YangLeftData, YangRightData};
+    inline StereoTableMip Ribbon = {RibbonLeftData, RibbonRightData};
+    inline StereoTableMip Outline = {OutlineLeftData, OutlineRightData};
+    inline StereoTableMip User = {UserLeftData, UserRightData};
+    inline StereoTableMip User2 = {User2LeftData, User2RightData};
+
+    // Circular 7-tap half-band filter + decimate by 2, same kernel as
+    // halfband.h. n is the destination (half) length.
+    inline void DecimateLevel(const int16_t *src, int16_t *dst, int n)
+    {
+        int n2 = 2 * n;
+        for (int i = 0; i < n; i++)
+        {
+            int m = 2 * i;
+            int32_t acc = 16384 * src[m] +
+                          9216 * (src[(m + 1) % n2] + src[(m + n2 - 1) % n2]) -
+                          1024 * (src[(m + 3) % n2] + src[(m + n2 - 3) % n2]);
+            dst[i] = (int16_t)(acc >> 15);
+        }
+    }
+
+    // Copy a flash StereoTable into a RAM mip pyramid and build the
+    // reduced levels. wavtable_prep.py can also pre-render mip levels
+    // offline; tables without them get this runtime derivation.
+    inline void LoadStereo(StereoTableMip &dst, const StereoTable &src)
+    {
+        memcpy(dst.left, src.left, sizeof(src.left));
+        memcpy(dst.right, src.right, sizeof(src.right));
+        for (int lvl = 1; lvl < StereoTableMip::levels; lvl++)
+        {
+            int n = 1024 >> lvl;
+            DecimateLevel(dst.Left(lvl - 1), dst.left + StereoTableMip::offsets[lvl], n);
+            DecimateLevel(dst.Right(lvl - 1), dst.right + StereoTableMip::offsets[lvl], n);
+        }
+    }
+
+    // Copy all hot tables from flash into their RAM homes.
+    // Call once at startup, before Run().
+    inline void Init()
+    {
+        memcpy(Sine, SINE_TABLE, sizeof(Sine));
+        memcpy(Blep, BLEP_TABLE, sizeof(Blep));
+        memcpy(Blamp, BLAMP_TABLE, sizeof(Blamp));
+        LoadStereo(Yin, YIN_TABLE);
+        LoadStereo(Yang, YANG_TABLE);
+        LoadStereo(Ribbon, RIBBON_TABLE);
+        LoadStereo(Outline, OUTLINE_TABLE);
+    }
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+// USB-serial shape upload into the flash bank region.
+//
+// Build with -DTRACE_USB_UPLOAD and without
+// -DPIO_FRAMEWORK_ARDUINO_NO_USB so the Arduino core brings the CDC
+// port up. Host side sends:
+//
+//   "TRUP"  uint8 cmd (0 = write bank image)  uint32 length (LE)
+//   then length bytes of a bank_pack.py image
+//
+// and reads one byte back: 'K' on success, 'E' on failure. See
+// util/shape_upload.py.
+//
+// The image streams into a RAM staging buffer while audio keeps
+// running; only the erase/program window pauses audio, through the
+// ComputerCard ADC pause handshake, so a shape swap mutes the outputs
+// for milliseconds instead of a reflash cycle. Poll() runs from
+// Housekeeping (outside the audio interrupt) and never blocks.
+
+#ifdef TRACE_USB_UPLOAD
+
+#include <Arduino.h>
+#include "ComputerCard.h"
+#include "bank_registry.h"
+#include "hardware/flash.h"
+#include "hardware/sync.h"
+
+namespace UsbUpload
+{
+    // Staging buffer; bounds the largest image (multiple of the flash
+    // page size so the final partial page can program from it)
+    constexpr uint32_t STAGING_MAX = 32 * 1024;
+    inline uint8_t staging[STAGING_MAX];
+    inline uint32_t length = 0;
+
+    // Receive state: bytes of header consumed, then payload fill
+    inline int state = 0;
+    inline uint8_t cmd = 0;
+    inline uint32_t need = 0;
+    inline uint32_t got = 0;
+
+    constexpr char MAGIC[4] = {'T', 'R', 'U', 'P'};
+
+    // Drain pending serial bytes; returns true once a complete,
+    // plausible image is staged (caller then pauses audio and commits)
+    inline bool Poll()
+    {
+        while (Serial.available() > 0)
+        {
+            uint8_t c = (uint8_t)Serial.read();
+            if (state < 4)
+            {
+                state = (c == (uint8_t)MAGIC[state]) ? state + 1 : (c == 'T');
+            }
+            else if (state == 4)
+            {
+                cmd = c;
+                state++;
+            }
+            else if (state < 9)
+            {
+                need |= (uint32_t)c << (8 * (state - 5));
+                state++;
+                if (state == 9)
+                {
+                    if (cmd != 0 || need == 0 || need > STAGING_MAX)
+                    {
+                        Serial.write('E');
+                        state = 0;
+                        need = 0;
+                        continue;
+                    }
+                    length = need;
+                    need = 0;
+                    got = 0;
+                }
+            }
+            else
+            {
+                staging[got++] = c;
+                if (got == length)
+                {
+                    state = 0;
+                    // must at least carry the registry magic
+                    uint32_t magic;
+                    memcpy(&magic, staging, 4);
+                    if (magic == BankRegistry::MAGIC)
+                        return true;
+                    Serial.write('E');
+                }
+            }
+        }
+        return false;
+    }
+
+    // Erase and program the bank region from the staging buffer.
+    // Audio must be paused; interrupts are masked across each flash
+    // operation because remaining handlers (USB, CV PWM) live in flash.
+    inline bool __not_in_flash_func(Commit)()
+    {
+        uint32_t eraseLen = (length + FLASH_SECTOR_SIZE - 1) & ~(FLASH_SECTOR_SIZE - 1);
+        uint32_t progLen = (length + FLASH_PAGE_SIZE - 1) & ~(FLASH_PAGE_SIZE - 1);
+
+        uint32_t ints = save_and_disable_interrupts();
+        flash_range_erase(TRACE_BANK_FLASH_OFFSET, eraseLen);
+        flash_range_program(TRACE_BANK_FLASH_OFFSET, staging, progLen);
+        restore_interrupts(ints);
+
+        return memcmp((const void *)(XIP_BASE + TRACE_BANK_FLASH_OFFSET),
+                      staging, length) == 0;
+    }
+
+    inline void Ack(bool ok)
+    {
+        Serial.write(ok ? 'K' : 'E');
+    }
+}
+
+#endif // TRACE_USB_UPLOAD
@@ -0,0 +1,128 @@
+// On-device oscillator benchmark.
+//
+// Built by the [env:pico_bench] PlatformIO environment instead of the
+// normal firmware (see build_src_filter in platformio.ini). Sweeps every
+// registered oscillator across representative phase increments and mod
+// values, measures cycles per rendered sample with the SysTick cycle
+// counter, and reports min/avg/max over USB serial. Runs on the real
+// M0+ with real flash wait states, so numbers are trustworthy in a way
+// host benchmarks are not.
+
+#include <Arduino.h>
+#include "ComputerCard.h"
+#include "hardware/structs/systick.h"
+#include "oscillator.h"
+#include "table_ram.h"
+#include "interp_lerp.h"
+#include "pitch.h"
+
+static YinYang yinyang;
+static PolyCube polycube;
+static PolyCone polycone;
+static PolyICO polyico;
+static YinYangCalligraphy yinyang_c;
+static RibbonWC ribbon;
+static OutlineWC outline;
+
+struct BenchEntry
+{
+  const char *name;
+  Oscillator *osc;
+  ComputeBlockFn render;
+};
+
+static BenchEntry entries[] = {
+    {"YinYang", &yinyang, computeBlockThunk<YinYang>},
+    {"PolyCube", &polycube, computeBlockThunk<PolyCube>},
+    {"PolyCone", &polycone, computeBlockThunk<PolyCone>},
+    {"PolyICO", &polyico, computeBlockThunk<PolyICO>},
+    {"YinYangCalligraphy", &yinyang_c, computeBlockThunk<YinYangCalligraphy>},
+    {"RibbonWC", &ribbon, computeBlockThunk<RibbonWC>},
+    {"OutlineWC", &outline, computeBlockThunk<OutlineWC>},
+};
+
+static constexpr int BLOCK = 32;
+static constexpr int REPS = 64;
+
+// Main-knob positions to sweep: low, mid and high register
+static constexpr int freqKnobs[] = {512, 2048, 3584};
+// Mod values to sweep: both knob extremes and centre
+static constexpr int32_t mods[] = {0, 2048, 4096};
+
+static uint32_t blockPhase[BLOCK];
+static int32_t blockOut[BLOCK][2];
+
+void setup()
+{
+  Serial.begin(115200);
+
+  TableRam::Init();
+  Pitch::Init();
+  InterpLerp::Setup();
+
+  // Free-running 24-bit cycle counter on the core clock
+  systick_hw->rvr = 0x00FFFFFF;
+  systick_hw->cvr = 0;
+  systick_hw->csr = 0x5; // enable, processor clock
+}
+
+void loop()
+{
+  Serial.println("osc, cycles/sample min, avg, max");
+
+  for (auto &e : entries)
+  {
+    uint32_t minCyc = 0xFFFFFFFF, maxCyc = 0;
+    uint64_t total = 0;
+    uint32_t samples = 0;
+
+    for (int freq : freqKnobs)
+    {
+      uint32_t inc = (uint32_t)Pitch::Increment(freq, 0);
+      for (int32_t mod1 : mods)
+      {
+        for (int32_t mod2 : mods)
+        {
+          uint32_t ph = 0;
+
+          // warm one block so caches and branch history settle
+          for (int i = 0; i < BLOCK; i++)
+          {
+            ph += inc;
+            blockPhase[i] = ph;
+          }
+          e.render(e.osc, blockPhase, mod1, mod2, blockOut, BLOCK);
+
+          for (int rep = 0; rep < REPS; rep++)
+          {
+            for (int i = 0; i < BLOCK; i++)
+            {
+              ph += inc;
+              blockPhase[i] = ph;
+            }
+
+            uint32_t t0 = systick_hw->cvr;
+            e.render(e.osc, blockPhase, mod1, mod2, blockOut, BLOCK);
+            uint32_t dt = (t0 - systick_hw->cvr) & 0x00FFFFFF;
+
+            uint32_t perSample = dt / BLOCK;
+            if (perSample < minCyc)
+              minCyc = perSample;
+            if (perSample > maxCyc)
+              maxCyc = perSample;
+            total += dt;
+            samples += BLOCK;
+          }
+        }
+      }
+    }
+
+    Serial.printf("%s, %lu, %lu, %lu\n", e.name,
+                  (unsigned long)minCyc,
+                  (unsigned long)(total / samples),
+                  (unsigned long)maxCyc);
+  }
+
+  Serial.println();
+  delay(5000);
+}
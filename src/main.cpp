@@ -1,27 +1,98 @@
 #include "ComputerCard.h"
 #include <cmath>
 #include "oscillator.h"
-#include "lookup_tables.h"
+#include "fixed_point.h"
+#include "table_ram.h"
+#include "halfband.h"
+#include "pitch.h"
+#include "bank_registry.h"
+#include "usb_upload.h"
+
+// Build with -DTRACE_DUAL_CORE to run oscillator rendering on core 1,
+// feeding the core 0 audio ISR through a lock-free frame ring
+#ifdef TRACE_DUAL_CORE
+#include "pico/multicore.h"
+#include "sample_ring.h"
+#endif
+
+// Build with -DTRACE_HARD_SYNC to repurpose Pulse In 2 as a hard sync
+// input: a GPIO edge interrupt timestamps the rising edge and the next
+// block starts the master phase exactly where a reset at the edge
+// instant would have left it, so external clocks lock the figure with
+// sub-sample accuracy instead of up to a sample of polling jitter
+#ifdef TRACE_HARD_SYNC
+#include "pico/time.h"
+#endif
 
 class WT : public ComputerCard
 {
   uint32_t phase;
   uint32_t ph_rot;
 
-  // Anti-aliasing filter state variables
-  int32_t filter_L = 0;
-  int32_t filter_R = 0;
+  // Oscillators render in blocks so virtual dispatch and per-sample
+  // setup inside compute() are amortized over BLOCK_SIZE samples.
+  // Blocks are rendered at 1x/2x/4x the output rate (per oscillator)
+  // and decimated through half-band stages, so buffers are sized for
+  // the highest oversampling factor.
+  static constexpr int BLOCK_SIZE = 16;
+  static constexpr int MAX_OS_SHIFT = 2; // up to 4x oversampling
+  uint32_t blockPhase[BLOCK_SIZE << MAX_OS_SHIFT];
+  int32_t blockOutOS[BLOCK_SIZE << MAX_OS_SHIFT][2];
+  int32_t blockOut[BLOCK_SIZE][2];
+  int blockPos = BLOCK_SIZE; // force a render on the first sample
+
+  // Beam intensity (Z blanking) alongside the audio blocks, mirrored
+  // to CV out 1 for the scope's Z input
+  int32_t blockZOS[BLOCK_SIZE << MAX_OS_SHIFT];
+  int32_t blockZ[BLOCK_SIZE] = {0};
+
+  // Half-band decimator chain; stage A runs at 4x (4x mode only),
+  // stage B produces the output rate
+  HalfBandDecimator decimLA, decimRA, decimLB, decimRB;
+
+  // Oscillator instance paired with its devirtualized render entry, so
+  // block dispatch goes through a RAM function pointer, not the vtable
+  struct OscSlot
+  {
+    Oscillator *osc;
+    ComputeBlockFn render;
+    uint8_t osShift; // log2 of the oversampling factor (0=1x, 1=2x, 2=4x)
+  };
+
+#ifdef TRACE_DUAL_CORE
+  // Pre-rendered frames from the core 1 render loop, drained by the ISR.
+  // Sized for a few blocks of slack so core 1 can absorb IRQ jitter.
+  SampleRing<64> ring;
+  StereoFrame lastFrame = {0, 0};
+  uint32_t paramCountdown = 0;
+
+  // Parameters handed from core 0 control code to the core 1 renderer.
+  // Each is a single aligned word, so plain volatile stores are safe.
+  // The oscillator selection travels as one pointer into the immutable
+  // bank tables: publishing osc, render and osShift as separate words
+  // would let core 1 pair a new oscillator with a stale render thunk,
+  // and the thunk's non-virtual call makes that a wrong-type cast.
+  const OscSlot *volatile rp_slot = nullptr;
+  volatile uint32_t rp_inc = 0;
+  volatile int32_t rp_mod1 = 0;
+  volatile int32_t rp_mod2 = 0;
 
-  // One-pole lowpass coefficient for ~21kHz cutoff at 48kHz sample rate
-  static constexpr int32_t FILTER_COEF = 57344; // 0.875 * 65536
+  static WT *instance;
+#endif
 
   YinYang yinyang;
   PolyCube polycube;
   PolyCone polycone;
   PolyICO polyico;
+  // Catmull-Rom pass over the icosphere control points: same vertex
+  // data, visibly rounder. Coefficients live here in RAM (48B/segment).
+  SplineMesh::Coef splineCoefs[ICOSPHERE_PATH_COUNT - 1];
+  SplineMesh splineICO{ICOSPHERE_PATH, ICOSPHERE_PATH_COUNT, splineCoefs};
   YinYangCalligraphy yinyang_c;
   RibbonWC ribbon;
   OutlineWC outline;
+  OutlineWC userWC{&TableRam::User}; // registry-loaded slot, bank C
+  MorphWC morph;                     // morphs Yin/Yang plus registry tables
 
   enum BANK
   {
@@ -30,18 +101,57 @@ class WT : public ComputerCard
     BANK_WT
   };
 
-  // Pointer to current oscillator
-  Oscillator *currentOsc;
+  // Currently selected oscillator slot
+  OscSlot current;
   uint8_t currentBank = BANK_FUNC;
   uint8_t currentOscIndex = 0;
 
+#ifdef TRACE_DUAL_VOICE
+  // Beam multiplexing: the previously selected oscillator stays alive
+  // as a second voice with its own phase, and the beam is time-sliced
+  // between the two figures. Only the shown voice renders each block
+  // (the beam can only be in one place), so a chunk costs the same as
+  // single-voice; the hidden voice's phase keeps running so its figure
+  // holds still. The beam hands over when the drawn figure completes
+  // its cycle, or after DUAL_MAX_CHUNK blocks at very low pitch.
+  //
+  // Engagement is gated on measured ISR load with hysteresis: above
+  // DUAL_LOAD_OFF percent the multiplexer falls back to the first
+  // voice alone, and stays there until load drops below DUAL_LOAD_ON.
+  // Single-core builds only; the core 1 render loop is unchanged.
+  static constexpr int32_t DUAL_LOAD_OFF = 85;
+  static constexpr int32_t DUAL_LOAD_ON = 70;
+  static constexpr uint32_t DUAL_MAX_CHUNK = 96; // blocks, = 32ms
+
+  OscSlot second = {nullptr, nullptr, 0};
+  uint32_t phase2 = 0;
+  uint8_t shownVoice = 0;   // voice the beam is drawing now
+  uint32_t chunkBlocks = 0; // blocks since the last handover
+  bool dualShed = false;    // degraded to single voice under load
+#endif
+
   // Array of oscillators for each bank
-  Oscillator *bankFunc[1] = {&yinyang};
-  Oscillator *bankMesh[3] = {&polycube, &polycone, &polyico};
-  Oscillator *bankWT[3] = {&yinyang_c, &ribbon, &outline};
+  OscSlot bankFunc[1] = {{&yinyang, computeBlockThunk<YinYang>, 1}};
+  OscSlot bankMesh[4] = {{&polycube, computeBlockThunk<PolyCube>, 1},
+                         {&polycone, computeBlockThunk<PolyCone>, 1},
+                         {&polyico, computeBlockThunk<PolyICO>, 1},
+                         {&splineICO, computeBlockThunk<SplineMesh>, 1}};
+  // Last slot is filled at boot if the flash registry holds a table
+  OscSlot bankWT[5] = {{&yinyang_c, computeBlockThunk<YinYangCalligraphy>, 1},
+                       {&ribbon, computeBlockThunk<RibbonWC>, 2},
+                       {&outline, computeBlockThunk<OutlineWC>, 2},
+                       {&morph, computeBlockThunk<MorphWC>, 1},
+                       {nullptr, nullptr, 0}};
+
+  OscSlot *banks[3] = {bankFunc, bankMesh, bankWT};
+  uint8_t bankSizes[3] = {1, 4, 4};
 
-  Oscillator **banks[3] = {bankFunc, bankMesh, bankWT};
-  uint8_t bankSizes[3] = {1, 3, 3};
+#ifdef TRACE_HARD_SYNC
+  // Written by the edge interrupt, consumed at the next block render.
+  // Each is a single aligned word, so plain volatile access is safe.
+  static volatile uint32_t syncStampUs;
+  static volatile bool syncPending;
+#endif
 
   int32_t mod1_off = 0;
   int32_t mod2_off = 0;
@@ -54,13 +164,203 @@ class WT : public ComputerCard
   int32_t knobx_last = 0;
   int32_t knoby_last = 0;
 
+  // Control-rate pipeline: knob scanning, guard logic and the pitch LUT
+  // lookup run every CONTROL_INTERVAL samples instead of at 48kHz (the
+  // ADC round-robin only refreshes knobs every few samples anyway).
+  // The render path slews the mods toward their targets, which also
+  // smooths zipper noise on fast knob sweeps.
+  static constexpr int CONTROL_INTERVAL = 32;
+  static constexpr int32_t MOD_SLEW_STEP = 64; // per rendered block
+  int controlCountdown = 0;
+
+  // Overload scheduler: when measured ISR load eats into the headroom,
+  // shed non-audio work in priority order before BufferFull starts
+  // missing its deadline. Each level adds one shed on top of the last:
+  //   1: hold off LED selection repaints
+  //   2: control-rate stage at a quarter rate
+  //   3: drop the oversampling factor one step
+  // Stepped at most once per load window with hysteresis, so a level
+  // gets a full measurement before the next one engages. The overload
+  // flag latches on the first shed and Housekeeping() blinks LED 5
+  // while it is set, so a transient overrun still leaves a trace.
+  // On dual-core builds core 0 only drains the frame ring, so the
+  // scheduler rarely climbs past the LED level there.
+  static constexpr int32_t SHED_LOAD_UP = 90;
+  static constexpr int32_t SHED_LOAD_DOWN = 78;
+  static constexpr int SHED_MAX_LEVEL = 3;
+  static constexpr int SHED_STEP_BLOCKS = 300; // one load window, ~0.1s
+  volatile int shedLevel = 0; // written by core 0, read in RenderBlock on core 1
+  int shedCountdown = 0;
+  bool overloadLatched = false;
+  int32_t mod1_target = 0;
+  int32_t mod2_target = 0;
+  int32_t mod1_cur = 0;
+  int32_t mod2_cur = 0;
+  uint32_t inc_target = 0;
+
+  // LED state, owned by the Housekeeping() loop. The audio code only
+  // bumps the dirty flag when the selection changes; the hardware PWM
+  // writes happen outside the ISR at ~100Hz. LEDs show the bank in
+  // binary on the left column (0/2/4) and the oscillator index on the
+  // right (1/3/5), ready for the planned 8x8 bank layout.
+  volatile uint32_t sampleCount = 0;
+  volatile bool ledDirty = true;
+  uint32_t ledLastRefresh = 0;
+
 public:
   WT()
   {
     phase = 0;
-    currentOsc = bankFunc[0];
+    current = bankFunc[0];
+
+    // Enumerate the flash bank registry; a stored table extends bank C
+    // and joins the morph list, a second one extends the list further
+    if (BankRegistry::LoadFirstStereo(TableRam::User))
+    {
+      bankWT[4] = {&userWC, computeBlockThunk<OutlineWC>, 2};
+      bankSizes[BANK_WT] = 5;
+      morph.AddTable(&TableRam::User);
+      if (BankRegistry::LoadNthStereo(1, TableRam::User2))
+        morph.AddTable(&TableRam::User2);
+    }
+#ifdef TRACE_DUAL_CORE
+    instance = this;
+    rp_slot = &banks[currentBank][currentOscIndex];
+#endif
   }
 
+#ifdef TRACE_DUAL_CORE
+  // Entry point for core 1, launched from main() before Run()
+  static void Core1Render()
+  {
+    instance->RenderLoop();
+  }
+
+  // Core 1 render loop: keep the frame ring topped up, one block at a
+  // time, using the parameters most recently published by core 0
+  void __not_in_flash_func(RenderLoop)()
+  {
+    uint32_t ph = 0;
+    while (true)
+    {
+      if (ring.Free() < (uint32_t)BLOCK_SIZE)
+        continue;
+
+      // One volatile pointer load, then a copy from the immutable bank
+      // entry it designates; never a mix of two selections
+      OscSlot slot = *rp_slot;
+#ifdef TRACE_HARD_SYNC
+      if (syncPending)
+      {
+        syncPending = false;
+        ph = SyncPhase(rp_inc);
+      }
+#endif
+      RenderBlock(slot, ph, rp_inc, rp_mod1, rp_mod2);
+      for (int i = 0; i < BLOCK_SIZE; i++)
+        ring.Push({blockOut[i][0], blockOut[i][1]});
+    }
+  }
+#endif
+
+  // Render one block at the slot's oversampling factor and decimate
+  // down to BLOCK_SIZE output frames in blockOut. The master phase is
+  // advanced by exactly inc per output sample so oversampling cannot
+  // drift the pitch.
+  void __not_in_flash_func(RenderBlock)(const OscSlot &slot, uint32_t &ph, uint32_t inc, int32_t mod1, int32_t mod2)
+  {
+    // claim this core's interp0 blend lanes for the table lookups
+    InterpLerp::Setup();
+
+    int shift = slot.osShift;
+    // Shed level 3: one oversampling step less halves the render and
+    // decimation work, at the cost of some aliasing headroom
+    if (shedLevel >= 3 && shift)
+      shift--;
+    int n = BLOCK_SIZE << shift;
+    uint32_t subInc = inc >> shift;
+
+    uint32_t sub = ph;
+    for (int i = 0; i < n; i++)
+    {
+      sub += subInc;
+      blockPhase[i] = sub;
+    }
+    ph += inc * BLOCK_SIZE;
+
+    slot.osc->SetZBuffer(blockZOS);
+    slot.render(slot.osc, blockPhase, mod1, mod2, blockOutOS, n);
+
+    switch (shift)
+    {
+    case 0:
+      for (int i = 0; i < BLOCK_SIZE; i++)
+      {
+        blockOut[i][0] = blockOutOS[i][0];
+        blockOut[i][1] = blockOutOS[i][1];
+      }
+      break;
+    case 1:
+      for (int i = 0; i < BLOCK_SIZE; i++)
+      {
+        blockOut[i][0] = decimLB.Process(blockOutOS[2 * i][0], blockOutOS[2 * i + 1][0]);
+        blockOut[i][1] = decimRB.Process(blockOutOS[2 * i][1], blockOutOS[2 * i + 1][1]);
+      }
+      break;
+    default:
+      // 4x: first halve 4x->2x in place, then 2x->1x
+      for (int i = 0; i < 2 * BLOCK_SIZE; i++)
+      {
+        blockOutOS[i][0] = decimLA.Process(blockOutOS[2 * i][0], blockOutOS[2 * i + 1][0]);
+        blockOutOS[i][1] = decimRA.Process(blockOutOS[2 * i][1], blockOutOS[2 * i + 1][1]);
+      }
+      for (int i = 0; i < BLOCK_SIZE; i++)
+      {
+        blockOut[i][0] = decimLB.Process(blockOutOS[2 * i][0], blockOutOS[2 * i + 1][0]);
+        blockOut[i][1] = decimRB.Process(blockOutOS[2 * i][1], blockOutOS[2 * i + 1][1]);
+      }
+      break;
+    }
+
+    // Z channel: keep the minimum over each decimated group, so one
+    // blanked sub-sample blanks the output sample
+    if (slot.osc->HasZ())
+    {
+      for (int i = 0; i < BLOCK_SIZE; i++)
+      {
+        int32_t z = blockZOS[i << shift];
+        for (int k = 1; k < (1 << shift); k++)
+          if (blockZOS[(i << shift) + k] < z)
+            z = blockZOS[(i << shift) + k];
+        blockZ[i] = z;
+      }
+    }
+    else
+    {
+      for (int i = 0; i < BLOCK_SIZE; i++)
+        blockZ[i] = Oscillator::BEAM_ON;
+    }
+  }
+
+#ifdef TRACE_HARD_SYNC
+  // The input transistor inverts, so the pulse rising edge arrives as
+  // a falling GPIO edge. Registered on PULSE_2_INPUT in main().
+  static void OnSyncEdge(uint gpio, uint32_t events)
+  {
+    syncStampUs = time_us_32();
+    syncPending = true;
+  }
+
+  // Phase the next block as if the reset landed exactly on the edge:
+  // microseconds since capture to samples in Q16 (1us = 48/1000
+  // sample at 48kHz), then on to phase units via the current increment
+  static uint32_t __not_in_flash_func(SyncPhase)(uint32_t inc)
+  {
+    uint32_t dtQ16 = (time_us_32() - syncStampUs) * 3146;
+    return (uint32_t)(((uint64_t)inc * dtQ16) >> 16);
+  }
+#endif
+
   void CycleOscillator()
   {
     // Move to next oscillator
@@ -74,45 +374,100 @@ public:
       currentOscIndex = 0;
     }
 
-    currentOsc = banks[currentBank][currentOscIndex];
+#ifdef TRACE_DUAL_VOICE
+    KeepAsSecondVoice();
+#endif
+    current = banks[currentBank][currentOscIndex];
+    ledDirty = true;
   }
 
-  static inline bool __not_in_flash_func(knobChanged)(int32_t prev, int32_t curr)
+#ifdef TRACE_DUAL_VOICE
+  // The outgoing selection becomes the second voice, drawn from the
+  // phase the new voice starts at so the figures interleave cleanly
+  void KeepAsSecondVoice()
   {
-    return (curr - prev > 4) || (prev - curr > 4);
+    second = current;
+    phase2 = phase;
   }
 
-  virtual void ProcessSample()
+  // Render the next block of the shown voice; the hidden voice only
+  // advances its phase
+  void __not_in_flash_func(DualRenderBlock)()
   {
-    // Send Pulse on PulseOut1 when changing oscillator
-    if (SwitchChanged() && SwitchVal() == Down)
+    if (LoadPercent() > DUAL_LOAD_OFF)
+      dualShed = true;
+    else if (LoadPercent() < DUAL_LOAD_ON)
+      dualShed = false;
+
+    bool dual = second.osc && second.osc != current.osc && !dualShed;
+    if (!dual)
+      shownVoice = 0;
+
+    uint32_t &ph = shownVoice ? phase2 : phase;
+    uint32_t before = ph;
+    RenderBlock(shownVoice ? second : current, ph, inc_target, mod1_cur, mod2_cur);
+
+    if (dual)
     {
-      CycleOscillator();
-      PulseOut1(true);
+      // hidden voice keeps time so its figure holds still
+      (shownVoice ? phase : phase2) += inc_target * BLOCK_SIZE;
+
+      // hand the beam over when the drawn figure completes. The
+      // half-band state carries a couple of samples across the
+      // handover, which only shades the beam jump between figures.
+      chunkBlocks++;
+      if (ph < before || chunkBlocks >= DUAL_MAX_CHUNK)
+      {
+        shownVoice ^= 1;
+        chunkBlocks = 0;
+      }
     }
-    else
+  }
+#endif
+
+  // Step the shed ladder, once per block but at most one level per
+  // load window (LoadPercent() is an average over that same window)
+  void __not_in_flash_func(ShedUpdate)()
+  {
+    if (shedCountdown > 0)
     {
-      PulseOut1(false);
+      shedCountdown--;
+      return;
     }
-    if (PulseIn1RisingEdge())
+    int32_t load = LoadPercent();
+    if (load > SHED_LOAD_UP && shedLevel < SHED_MAX_LEVEL)
     {
-      currentBank = (currentBank + 1) % 3;
-      currentOscIndex = 0;
-      currentOsc = banks[currentBank][currentOscIndex];
+      shedLevel++;
+      overloadLatched = true;
+      shedCountdown = SHED_STEP_BLOCKS;
     }
-    if (PulseIn2RisingEdge())
+    else if (load < SHED_LOAD_DOWN && shedLevel > 0)
     {
-      currentOscIndex = (currentOscIndex + 1) % bankSizes[currentBank];
-      currentOsc = banks[currentBank][currentOscIndex];
+      shedLevel--;
+      shedCountdown = SHED_STEP_BLOCKS;
     }
+  }
 
-    // Set guards when switch changes to prevent parameter jumps
-    if (SwitchChanged())
-    {
-      mod1guard = true;
-      mod2guard = true;
-    }
+  static inline bool __not_in_flash_func(knobChanged)(int32_t prev, int32_t curr)
+  {
+    return (curr - prev > 4) || (prev - curr > 4);
+  }
 
+  // Linear slew, at most MOD_SLEW_STEP per rendered block
+  static inline int32_t __not_in_flash_func(slewTo)(int32_t cur, int32_t target)
+  {
+    int32_t d = target - cur;
+    if (d > MOD_SLEW_STEP)
+      d = MOD_SLEW_STEP;
+    if (d < -MOD_SLEW_STEP)
+      d = -MOD_SLEW_STEP;
+    return cur + d;
+  }
+
+  // Control-rate stage: everything that only needs to track knob and CV
+  // movement, pulled out of the per-sample path
+  void __not_in_flash_func(ControlUpdate)()
+  {
     // Read current knob positions
     int32_t knobx_curr = KnobVal(X);
     int32_t knoby_curr = KnobVal(Y);
@@ -145,44 +500,216 @@ public:
         mod2_off = knoby_curr;
     }
 
-    int32_t mod1 = mod1_off + (AudioIn1() * mod1_att >> 12);
-    int32_t mod2 = mod2_off + (AudioIn2() * mod2_att >> 12);
+    mod1_target = mod1_off + FixedPoint::MulQ12(AudioIn1(), mod1_att);
+    mod2_target = mod2_off + FixedPoint::MulQ12(AudioIn2(), mod2_att);
 
-    // oscillator phase increment
-    int32_t freq = KnobVal(Main) + CVIn1();
-    phase += FREQ_INC_LUT_EXP[freq > 4095 ? 4095 : (freq < 0 ? 0 : freq)];
+    // oscillator phase increment: knob sweeps the same six octaves as
+    // before, CV1 now tracks 1V/oct through the exp2 engine
+    inc_target = Pitch::Increment(KnobVal(Main), CVIn1());
+  }
 
-    // prepare output
-    int32_t out[2];
+  virtual void ProcessSample()
+  {
+    // Send Pulse on PulseOut1 when changing oscillator
+    if (SwitchChanged() && SwitchVal() == Down)
+    {
+      CycleOscillator();
+      PulseOut1(true);
+    }
+    else
+    {
+      PulseOut1(false);
+    }
+    if (PulseIn1RisingEdge())
+    {
+      currentBank = (currentBank + 1) % 3;
+      currentOscIndex = 0;
+#ifdef TRACE_DUAL_VOICE
+      KeepAsSecondVoice();
+#endif
+      current = banks[currentBank][currentOscIndex];
+      ledDirty = true;
+    }
+#ifndef TRACE_HARD_SYNC
+    // With hard sync enabled Pulse In 2 belongs to the edge interrupt
+    if (PulseIn2RisingEdge())
+    {
+      currentOscIndex = (currentOscIndex + 1) % bankSizes[currentBank];
+#ifdef TRACE_DUAL_VOICE
+      KeepAsSecondVoice();
+#endif
+      current = banks[currentBank][currentOscIndex];
+      ledDirty = true;
+    }
+#endif
+
+    // Set guards when switch changes to prevent parameter jumps
+    // (edge detection must stay per-sample; the flag lasts one sample)
+    if (SwitchChanged())
+    {
+      mod1guard = true;
+      mod2guard = true;
+    }
+
+    // Control-rate stage
+    if (controlCountdown == 0)
+    {
+      ControlUpdate();
+      // Shed level 2: quarter control rate; the slew limiter already
+      // smooths over the coarser target updates
+      controlCountdown = shedLevel >= 2 ? CONTROL_INTERVAL * 4 : CONTROL_INTERVAL;
+    }
+    controlCountdown--;
+
+#ifdef TRACE_DUAL_CORE
+    // Publish render parameters for core 1 at block rate
+    if (paramCountdown == 0)
+    {
+      ShedUpdate();
+      mod1_cur = slewTo(mod1_cur, mod1_target);
+      mod2_cur = slewTo(mod2_cur, mod2_target);
+      rp_mod1 = mod1_cur;
+      rp_mod2 = mod2_cur;
+      rp_inc = inc_target;
+      rp_slot = &banks[currentBank][currentOscIndex];
+      paramCountdown = BLOCK_SIZE;
+    }
+    paramCountdown--;
 
-    // Call compute on the current oscillator using pointer
-    currentOsc->compute(phase, mod1, mod2, out);
+    // Drain one pre-rendered frame; hold the last one if core 1 is behind
+    ring.Pop(lastFrame);
+    int32_t outL = lastFrame.l;
+    int32_t outR = lastFrame.r;
+#else
+    // Render the next block when the previous one is used up.
+    // Mods and pitch are latched once per block.
+    if (blockPos == BLOCK_SIZE)
+    {
+      ShedUpdate();
+      mod1_cur = slewTo(mod1_cur, mod1_target);
+      mod2_cur = slewTo(mod2_cur, mod2_target);
+
+#ifdef TRACE_HARD_SYNC
+      if (syncPending)
+      {
+        syncPending = false;
+        phase = SyncPhase(inc_target);
+      }
+#endif
 
-    // Apply anti-aliasing filter to both channels
-    filter_L += ((out[0] - filter_L) * FILTER_COEF) >> 16;
-    filter_R += ((out[1] - filter_R) * FILTER_COEF) >> 16;
+#ifdef TRACE_DUAL_VOICE
+      DualRenderBlock();
+#else
+      RenderBlock(current, phase, inc_target, mod1_cur, mod2_cur);
+#endif
+      blockPos = 0;
+    }
 
-    AudioOut1(filter_L);
-    AudioOut2(filter_R);
+    int32_t outL = blockOut[blockPos][0];
+    int32_t outR = blockOut[blockPos][1];
 
-    LedOn(0, currentBank * 2 == 0);
-    LedOn(1, currentOscIndex * 2 + 1 == 1);
-    LedOn(2, currentBank * 2 == 2);
-    LedOn(3, currentOscIndex * 2 + 1 == 3);
-    LedOn(4, currentBank * 2 == 4);
-    LedOn(5, currentOscIndex * 2 + 1 == 5);
+    // Beam Z to the scope's blanking input, through the dithered
+    // 19-bit CV path: one store per sample, the PWM wrap IRQ does the
+    // rest. Intensity 0..2047 spans the positive CV range.
+    CVOut1Precise(blockZ[blockPos] << 7);
+    blockPos++;
+#endif
 
-    // debug LEDs for mod guards
-    // LedOn(4, mod1guard);
-    // LedOn(5, mod2guard);
+    // Anti-aliasing is handled by the half-band decimation in
+    // RenderBlock. Saturate instead of letting the 12-bit DAC write
+    // wrap: decimator overshoot on full-scale edges can poke a few
+    // percent past the rails.
+    AudioOut1(FixedPoint::SatAudio(outL));
+    AudioOut2(FixedPoint::SatAudio(outR));
+
+    sampleCount = sampleCount + 1;
+  }
+
+  // True once the overload scheduler has had to shed anything; stays
+  // set until reboot
+  bool Overloaded() const { return overloadLatched; }
+
+  // Runs outside the audio interrupt; refresh LEDs at ~100Hz and only
+  // when the selection actually changed
+  virtual void Housekeeping()
+  {
+#ifdef TRACE_USB_UPLOAD
+    // Shape upload: stage over USB while audio runs, pause only for
+    // the flash write, then pick up the new registry contents
+    if (UsbUpload::Poll())
+    {
+      PauseAudio();
+      bool ok = UsbUpload::Commit();
+      ResumeAudio();
+      if (ok && BankRegistry::LoadFirstStereo(TableRam::User))
+      {
+        bankWT[4] = {&userWC, computeBlockThunk<OutlineWC>, 2};
+        bankSizes[BANK_WT] = 5;
+        morph.AddTable(&TableRam::User);
+        if (BankRegistry::LoadNthStereo(1, TableRam::User2))
+          morph.AddTable(&TableRam::User2);
+        ledDirty = true;
+      }
+      UsbUpload::Ack(ok);
+    }
+#endif
+
+    // Latched overload indicator: LED 5 blinks at ~1.5Hz once the
+    // scheduler has shed anything, and keeps blinking after recovery
+    // so a transient overrun is still visible later
+    if (overloadLatched)
+      LedOn(5, (sampleCount >> 14) & 1);
+
+    if (!ledDirty)
+      return;
+    // Shed level 1: hold off selection repaints while overloaded; the
+    // dirty flag stays set so the display catches up on recovery
+    if (shedLevel >= 1)
+      return;
+    uint32_t now = sampleCount;
+    if (now - ledLastRefresh < 480)
+      return;
+    ledLastRefresh = now;
+    ledDirty = false;
+
+    uint8_t bank = currentBank;
+    uint8_t osc = currentOscIndex;
+    LedOn(0, bank & 1);
+    LedOn(2, bank & 2);
+    LedOn(4, bank & 4);
+    LedOn(1, osc & 1);
+    LedOn(3, osc & 2);
+    LedOn(5, osc & 4);
   }
 
 protected:
 };
 
+#ifdef TRACE_DUAL_CORE
+WT *WT::instance = nullptr;
+#endif
+
+#ifdef TRACE_HARD_SYNC
+volatile uint32_t WT::syncStampUs;
+volatile bool WT::syncPending = false;
+#endif
+
 int main()
 {
   set_sys_clock_khz(192000, true);
+
+  // Pull hot lookup tables out of flash before audio starts
+  TableRam::Init();
+  Pitch::Init();
+
   WT wt;
+#ifdef TRACE_HARD_SYNC
+  // Pulse inputs are configured by the ComputerCard constructor, so
+  // the edge interrupt can be armed as soon as the card exists
+  gpio_set_irq_enabled_with_callback(PULSE_2_INPUT, GPIO_IRQ_EDGE_FALL, true, WT::OnSyncEdge);
+#endif
+#ifdef TRACE_DUAL_CORE
+  multicore_launch_core1(WT::Core1Render);
+#endif
   wt.Run();
 }
@@ -0,0 +1,585 @@
+// Host-native golden tests and throughput benchmarks for the oscillator
+// stack. Built by test/native/Makefile with -DTRACE_HOST_BUILD, which
+// turns ComputerCard.h into a macro shim, so everything here runs on a
+// desktop with no pico-sdk installed.
+//
+//   ./trace_tests            compare rendered output against golden/
+//   ./trace_tests --update   rewrite the golden vectors from current code
+//   ./trace_tests --bench    time computeBlock throughput per oscillator
+//
+// Golden vectors are checked in; a diff in one means the fixed-point
+// output changed and should be reviewed, not silently regenerated.
+
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <cstdarg>
+#include <unistd.h>
+#include <chrono>
+#include <vector>
+#include <string>
+
+#include "table_ram.h"
+#include "oscillator.h"
+#include "halfband.h"
+#include "sample_ring.h"
+#include "pitch.h"
+#include "bank_registry.h"
+
+static constexpr int BLOCK = 32;
+static constexpr int GOLDEN_BLOCKS = 8; // 256 frames per run
+
+struct GoldenCase
+{
+    const char *name;
+    Oscillator *osc;
+    ComputeBlockFn render;
+};
+
+static int failures = 0;
+
+static void fail(const char *fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    printf("FAIL: ");
+    vprintf(fmt, args);
+    printf("\n");
+    va_end(args);
+    failures++;
+}
+
+// Render a deterministic sequence from a freshly constructed oscillator:
+// two runs back to back, one at a low and one at a high phase increment,
+// so both the interpolation fraction handling and the mip selection in
+// the wavetable bank get exercised.
+static std::vector<int32_t> renderCase(const GoldenCase &c)
+{
+    std::vector<int32_t> frames;
+    uint32_t blockPhase[BLOCK];
+    int32_t blockOut[BLOCK][2];
+
+    // ~28Hz and ~365Hz; literal so golden inputs never drift with the
+    // pitch engine
+    const uint32_t incs[2] = {2531476, 34080977};
+    const int32_t mod1 = 3000, mod2 = 2500; // off-centre: rotation step nonzero
+
+    for (uint32_t inc : incs)
+    {
+        uint32_t ph = 0;
+        for (int b = 0; b < GOLDEN_BLOCKS; b++)
+        {
+            for (int i = 0; i < BLOCK; i++)
+            {
+                ph += inc;
+                blockPhase[i] = ph;
+            }
+            c.render(c.osc, blockPhase, mod1, mod2, blockOut, BLOCK);
+            for (int i = 0; i < BLOCK; i++)
+            {
+                frames.push_back(blockOut[i][0]);
+                frames.push_back(blockOut[i][1]);
+            }
+        }
+    }
+    return frames;
+}
+
+static std::string goldenPath(const char *name)
+{
+    return std::string("golden/") + name + ".txt";
+}
+
+static void updateGolden(const GoldenCase &c)
+{
+    std::vector<int32_t> frames = renderCase(c);
+    FILE *f = fopen(goldenPath(c.name).c_str(), "w");
+    if (!f)
+    {
+        fail("%s: cannot write golden file", c.name);
+        return;
+    }
+    for (size_t i = 0; i < frames.size(); i += 2)
+        fprintf(f, "%d %d\n", frames[i], frames[i + 1]);
+    fclose(f);
+    printf("wrote %s (%zu frames)\n", goldenPath(c.name).c_str(), frames.size() / 2);
+}
+
+static void checkGolden(const GoldenCase &c)
+{
+    std::vector<int32_t> frames = renderCase(c);
+    FILE *f = fopen(goldenPath(c.name).c_str(), "r");
+    if (!f)
+    {
+        fail("%s: missing golden file (run with --update)", c.name);
+        return;
+    }
+    size_t idx = 0;
+    int l, r, line = 0;
+    while (fscanf(f, "%d %d", &l, &r) == 2)
+    {
+        line++;
+        if (idx + 1 >= frames.size())
+        {
+            fail("%s: golden file longer than rendered output", c.name);
+            break;
+        }
+        if (frames[idx] != l || frames[idx + 1] != r)
+        {
+            fail("%s: frame %d is (%d, %d), golden says (%d, %d)",
+                 c.name, line - 1, frames[idx], frames[idx + 1], l, r);
+            break;
+        }
+        idx += 2;
+    }
+    fclose(f);
+    if (failures == 0 && idx != frames.size())
+        fail("%s: golden file shorter than rendered output", c.name);
+    if (idx == frames.size())
+        printf("ok:   %s (%zu frames)\n", c.name, idx / 2);
+}
+
+static void benchCase(const GoldenCase &c)
+{
+    uint32_t blockPhase[BLOCK];
+    int32_t blockOut[BLOCK][2];
+    const uint32_t inc = 7161914; // ~80Hz
+    constexpr int SAMPLES = 1 << 21;
+
+    uint32_t ph = 0;
+    volatile int32_t sink = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int done = 0; done < SAMPLES; done += BLOCK)
+    {
+        for (int i = 0; i < BLOCK; i++)
+        {
+            ph += inc;
+            blockPhase[i] = ph;
+        }
+        c.render(c.osc, blockPhase, 3000, 2500, blockOut, BLOCK);
+        sink += blockOut[BLOCK - 1][0];
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    (void)sink;
+
+    double secs = std::chrono::duration<double>(t1 - t0).count();
+    printf("%-20s %8.1f Msamples/s\n", c.name, SAMPLES / secs / 1e6);
+}
+
+// Plumbing sanity checks, no goldens needed
+static void checkHalfband()
+{
+    HalfBandDecimator d;
+    int32_t y = 0;
+    for (int i = 0; i < 16; i++)
+        y = d.Process(1000, 1000); // DC in
+    if (y < 998 || y > 1002)
+        fail("halfband: DC gain off, got %d for 1000 in", y);
+    else
+        printf("ok:   halfband DC\n");
+}
+
+// Mirror of mesh_prep.py delta_encode: signed byte per axis, 0x80
+// escaping to absolute int16
+static std::vector<uint8_t> deltaEncode(const Point3D *pts, uint32_t n)
+{
+    std::vector<uint8_t> out;
+    Point3D prev = {0, 0, 0};
+    for (uint32_t i = 0; i < n; i++)
+    {
+        int16_t cur[3] = {pts[i].x, pts[i].y, pts[i].z};
+        int16_t pre[3] = {prev.x, prev.y, prev.z};
+        for (int a = 0; a < 3; a++)
+        {
+            int d = cur[a] - pre[a];
+            if (d >= -127 && d <= 127)
+                out.push_back((uint8_t)d);
+            else
+            {
+                out.push_back(0x80);
+                out.push_back((uint8_t)(cur[a] & 0xFF));
+                out.push_back((uint8_t)((cur[a] >> 8) & 0xFF));
+            }
+        }
+        prev = pts[i];
+    }
+    return out;
+}
+
+// DeltaMesh must decode to exactly what the expanded-path PolyMesh
+// renders, including after backward seeks from phase wrap and grow slew
+static void checkDeltaMesh()
+{
+    std::vector<uint8_t> enc = deltaEncode(ICOSPHERE_PATH, ICOSPHERE_PATH_COUNT);
+    DeltaMeshPath path = {enc.data(), ICOSPHERE_PATH_COUNT};
+
+    PolyICO ref;
+    DeltaMesh dut(&path);
+
+    uint32_t blockPhase[BLOCK];
+    int32_t refOut[BLOCK][2], dutOut[BLOCK][2];
+
+    uint32_t ph = 0;
+    const uint32_t inc = 34080977; // fast enough to wrap several times
+    for (int b = 0; b < 64; b++)
+    {
+        for (int i = 0; i < BLOCK; i++)
+        {
+            ph += inc;
+            blockPhase[i] = ph;
+        }
+        // sweep grow so the scaled phase also jumps backward mid-cycle
+        int32_t grow = 2000 + b * 30;
+        ref.computeBlock(blockPhase, grow, 2500, refOut, BLOCK);
+        dut.computeBlock(blockPhase, grow, 2500, dutOut, BLOCK);
+        for (int i = 0; i < BLOCK; i++)
+            if (refOut[i][0] != dutOut[i][0] || refOut[i][1] != dutOut[i][1])
+            {
+                fail("delta mesh: block %d frame %d is (%d, %d), expanded path says (%d, %d)",
+                     b, i, dutOut[i][0], dutOut[i][1], refOut[i][0], refOut[i][1]);
+                return;
+            }
+    }
+    printf("ok:   delta mesh (%zu bytes vs %zu expanded)\n",
+           enc.size(), (size_t)ICOSPHERE_PATH_COUNT * sizeof(Point3D));
+}
+
+// With its default two-table list, MorphWC must reproduce the
+// YinYangCalligraphy blend exactly (up to the calligraphy-specific
+// right-channel inversion) at every morph position
+static void checkMorph()
+{
+    YinYangCalligraphy ref;
+    MorphWC dut;
+
+    uint32_t blockPhase[BLOCK];
+    int32_t refOut[BLOCK][2], dutOut[BLOCK][2];
+
+    uint32_t ph = 0;
+    const uint32_t inc = 2531476;
+    for (int b = 0; b < 64; b++)
+    {
+        for (int i = 0; i < BLOCK; i++)
+        {
+            ph += inc;
+            blockPhase[i] = ph;
+        }
+        int32_t morphPos = b * 64; // sweep the whole morph range
+        ref.computeBlock(blockPhase, 3000, morphPos, refOut, BLOCK);
+        dut.computeBlock(blockPhase, 3000, morphPos, dutOut, BLOCK);
+        for (int i = 0; i < BLOCK; i++)
+        {
+            // calligraphy negates before its >>19 and the shift rounds
+            // toward -inf, so the inverted channel may sit one LSB off
+            int32_t rsum = refOut[i][1] + dutOut[i][1];
+            if (refOut[i][0] != dutOut[i][0] || rsum > 0 || rsum < -1)
+            {
+                fail("morph: block %d frame %d is (%d, %d), calligraphy blend says (%d, %d)",
+                     b, i, dutOut[i][0], dutOut[i][1], refOut[i][0], refOut[i][1]);
+                return;
+            }
+        }
+    }
+    printf("ok:   morph engine (two-table blend matches calligraphy)\n");
+}
+
+// Build a registry image in memory (same layout as util/bank_pack.py),
+// enumerate it and load the stereo entry into a RAM mip slot
+static void checkBankRegistry()
+{
+    // payload: stereo table derived from the yin table so the expected
+    // mip pyramid can be compared against TableRam's own derivation
+    std::vector<uint8_t> image;
+    auto push16 = [&](uint16_t v) { image.push_back(v & 0xFF); image.push_back(v >> 8); };
+    auto push32 = [&](uint32_t v) { for (int i = 0; i < 4; i++) image.push_back((v >> (8 * i)) & 0xFF); };
+
+    std::vector<uint8_t> enc = deltaEncode(ICOSPHERE_PATH, ICOSPHERE_PATH_COUNT);
+
+    uint32_t stereoOff = 8 + 2 * 16;
+    uint32_t deltaOff = stereoOff + 4096;
+    push32(BankRegistry::MAGIC);
+    push16(BankRegistry::VERSION);
+    push16(2);
+    // entry 0: stereo table
+    push16(BankRegistry::StereoTableType);
+    push16(0);
+    push32(stereoOff);
+    push32(4096);
+    push32(0);
+    // entry 1: delta mesh
+    push16(BankRegistry::DeltaPathType);
+    push16(0);
+    push32(deltaOff);
+    push32((uint32_t)enc.size());
+    push32(ICOSPHERE_PATH_COUNT);
+    for (int i = 0; i < 1024; i++)
+        push16((uint16_t)YIN_TABLE.left[i]);
+    for (int i = 0; i < 1024; i++)
+        push16((uint16_t)YIN_TABLE.right[i]);
+    image.insert(image.end(), enc.begin(), enc.end());
+
+    BankRegistry::SetBase(image.data());
+    if (!BankRegistry::Valid() || BankRegistry::Count() != 2)
+    {
+        fail("registry: image did not enumerate");
+        return;
+    }
+
+    static int16_t leftBuf[StereoTableMip::totalSize], rightBuf[StereoTableMip::totalSize];
+    StereoTableMip slot = {leftBuf, rightBuf};
+    if (!BankRegistry::LoadStereo(*BankRegistry::Get(0), slot))
+    {
+        fail("registry: stereo load refused");
+        return;
+    }
+    // must match the boot-time derivation of the same table exactly
+    if (memcmp(leftBuf, TableRam::YinLeftData, sizeof(leftBuf)) ||
+        memcmp(rightBuf, TableRam::YinRightData, sizeof(rightBuf)))
+    {
+        fail("registry: loaded mip pyramid differs from TableRam's");
+        return;
+    }
+
+    DeltaMeshPath path;
+    if (!BankRegistry::GetDeltaPath(*BankRegistry::Get(1), path) ||
+        path.count != ICOSPHERE_PATH_COUNT)
+    {
+        fail("registry: delta path entry bad");
+        return;
+    }
+    // wrong-type loads must be refused
+    if (BankRegistry::LoadStereo(*BankRegistry::Get(1), slot))
+    {
+        fail("registry: stereo load accepted a delta entry");
+        return;
+    }
+    // oversized counts must be refused before they reach the decoder's
+    // fixed checkpoint array
+    BankRegistry::Entry big = *BankRegistry::Get(1);
+    big.count = 4097;
+    if (BankRegistry::GetDeltaPath(big, path))
+    {
+        fail("registry: delta path accepted count %u", big.count);
+        return;
+    }
+    printf("ok:   bank registry\n");
+}
+
+static void checkPitch()
+{
+    // Window endpoints: 10Hz bottom, six octaves up
+    if (Pitch::Exp2(0) != 894784)
+        fail("pitch: bottom of range is %d", Pitch::Exp2(0));
+    if (Pitch::Exp2(Pitch::MAX_PITCH) != 894784 << 6)
+        fail("pitch: top of range is %d", Pitch::Exp2(Pitch::MAX_PITCH));
+
+    // One octave up must double the increment exactly, and one CV volt
+    // must be one octave: 1V = 2048/6 counts = 341.33, so use 3V = 1024
+    // counts to stay integral
+    for (int32_t p = 0; p <= (4 << 16); p += 12345)
+        if (Pitch::Exp2(p + 65536) != Pitch::Exp2(p) << 1)
+        {
+            fail("pitch: octave at %d is not a doubling", p);
+            return;
+        }
+    if (Pitch::Increment(1024, 1024) != Pitch::Increment(1024, 0) << 3)
+        fail("pitch: 3V of CV is not three octaves");
+
+    // Monotonic across the whole window
+    int32_t prev = Pitch::Exp2(0);
+    for (int32_t p = 1; p <= Pitch::MAX_PITCH; p += 997)
+    {
+        int32_t cur = Pitch::Exp2(p);
+        if (cur < prev)
+        {
+            fail("pitch: non-monotonic at %d", p);
+            return;
+        }
+        prev = cur;
+    }
+    printf("ok:   pitch exp2\n");
+}
+
+static void checkFixedPoint()
+{
+    // Pseudo-random sweep against the 64-bit / ternary references
+    uint32_t x = 0x12345678;
+    for (int i = 0; i < 100000; i++)
+    {
+        x = x * 1664525 + 1013904223;
+        uint32_t a = x;
+        x = x * 1664525 + 1013904223;
+        uint32_t b = x;
+
+        if (FixedPoint::MulHi(a, b) != (uint32_t)(((uint64_t)a * b) >> 32))
+        {
+            fail("fixp: MulHi(%u, %u) wrong", a, b);
+            return;
+        }
+        if (FixedPoint::MulHiS((int32_t)a, (int32_t)b) !=
+            (int32_t)(((int64_t)(int32_t)a * (int32_t)b) >> 32))
+        {
+            fail("fixp: MulHiS(%d, %d) wrong", (int32_t)a, (int32_t)b);
+            return;
+        }
+
+        int32_t v = (int32_t)a >> 16; // keep v - lo clear of underflow
+        int32_t ref = v < 0 ? 0 : (v > 4096 ? 4096 : v);
+        if (FixedPoint::Clamp(v, 0, 4096) != ref)
+        {
+            fail("fixp: Clamp(%d) gave %d", v, FixedPoint::Clamp(v, 0, 4096));
+            return;
+        }
+        ref = v < -2048 ? -2048 : (v > 2047 ? 2047 : v);
+        if (FixedPoint::SatAudio(v) != ref)
+        {
+            fail("fixp: SatAudio(%d) gave %d", v, FixedPoint::SatAudio(v));
+            return;
+        }
+    }
+    printf("ok:   fixed point helpers\n");
+}
+
+// The band-limited primitives are protected helpers on the base class
+struct BlepProbe : Oscillator
+{
+    void compute(uint32_t, int32_t, int32_t, int32_t *) override {}
+    using Oscillator::saw;
+    using Oscillator::sqr;
+    using Oscillator::tri;
+    using Oscillator::sawBL;
+    using Oscillator::sqrBL;
+    using Oscillator::triBL;
+};
+
+static void checkBlep()
+{
+    BlepProbe p;
+
+    // A high note, where naive aliasing is worst: ~1.5kHz
+    const uint32_t inc = 1u << 27;
+
+    // Away from any discontinuity the BL versions are the naive ones
+    for (uint32_t ph = 3 * inc; ph < 0x80000000u - 3 * inc; ph += 0x01000000u)
+        if (p.sawBL(ph, inc) != p.saw(ph) ||
+            p.sqrBL(ph, inc) != p.sqr(ph) ||
+            p.triBL(ph, inc) != p.tri(ph))
+        {
+            fail("blep: residual applied away from a discontinuity at %u", ph);
+            return;
+        }
+
+    // Across the wrap the corrected saw transitions instead of jumping:
+    // the largest sample-to-sample move must be well below the 4096
+    // naive step (continuous polyBLEP caps it at 3/4 of the step)
+    int32_t maxStep = 0, prev = p.sawBL(0x70000000u, inc);
+    for (uint32_t ph = 0x70000000u + inc; ph > 0x60000000u; ph += inc)
+    {
+        int32_t cur = p.sawBL(ph, inc);
+        int32_t d = cur > prev ? cur - prev : prev - cur;
+        if (d > maxStep)
+            maxStep = d;
+        prev = cur;
+    }
+    if (maxStep > 3200)
+    {
+        fail("blep: saw still jumps %d across the wrap", maxStep);
+        return;
+    }
+
+    // polyBLAMP rounds the triangle peak downward and the trough upward
+    if (p.triBL(0x80000000u, inc) >= p.tri(0x80000000u))
+        fail("blep: triangle peak not rounded down");
+    else if (p.triBL(0, inc) <= p.tri(0))
+        fail("blep: triangle trough not rounded up");
+    else
+        printf("ok:   polyblep primitives (max saw step %d)\n", maxStep);
+}
+
+static void checkRing()
+{
+    SampleRing<8> ring;
+    for (int i = 0; i < 5; i++)
+        ring.Push({i, -i});
+    for (int i = 0; i < 5; i++)
+    {
+        StereoFrame fr;
+        if (!ring.Pop(fr) || fr.l != i || fr.r != -i)
+        {
+            fail("ring: pop %d came back wrong", i);
+            return;
+        }
+    }
+    StereoFrame fr;
+    if (ring.Pop(fr))
+        fail("ring: pop from empty ring succeeded");
+    else
+        printf("ok:   sample ring\n");
+}
+
+int main(int argc, char **argv)
+{
+    bool update = argc > 1 && !strcmp(argv[1], "--update");
+    bool bench = argc > 1 && !strcmp(argv[1], "--bench");
+
+    // Goldens live next to the binary; allow running from anywhere
+    std::string self(argv[0]);
+    size_t slash = self.rfind('/');
+    if (slash != std::string::npos)
+        (void)chdir(self.substr(0, slash).c_str());
+
+    TableRam::Init();
+    Pitch::Init();
+
+    YinYang yinyang;
+    PolyCube polycube;
+    PolyCone polycone;
+    PolyICO polyico;
+    static SplineMesh::Coef splineCoefs[ICOSPHERE_PATH_COUNT - 1];
+    SplineMesh spline_ico{ICOSPHERE_PATH, ICOSPHERE_PATH_COUNT, splineCoefs};
+    YinYangCalligraphy yinyang_c;
+    RibbonWC ribbon;
+    OutlineWC outline;
+    MorphWC morph_wc;
+
+    GoldenCase cases[] = {
+        {"yinyang", &yinyang, computeBlockThunk<YinYang>},
+        {"polycube", &polycube, computeBlockThunk<PolyCube>},
+        {"polycone", &polycone, computeBlockThunk<PolyCone>},
+        {"polyico", &polyico, computeBlockThunk<PolyICO>},
+        {"spline_ico", &spline_ico, computeBlockThunk<SplineMesh>},
+        {"yinyang_calligraphy", &yinyang_c, computeBlockThunk<YinYangCalligraphy>},
+        {"ribbon_wc", &ribbon, computeBlockThunk<RibbonWC>},
+        {"outline_wc", &outline, computeBlockThunk<OutlineWC>},
+        {"morph_wc", &morph_wc, computeBlockThunk<MorphWC>},
+    };
+
+    if (bench)
+    {
+        for (auto &c : cases)
+            benchCase(c);
+        return 0;
+    }
+
+    for (auto &c : cases)
+        update ? updateGolden(c) : checkGolden(c);
+
+    if (!update)
+    {
+        checkHalfband();
+        checkRing();
+        checkPitch();
+        checkBlep();
+        checkFixedPoint();
+        checkDeltaMesh();
+        checkMorph();
+        checkBankRegistry();
+    }
+
+    if (failures)
+    {
+        printf("%d failure(s)\n", failures);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,86 @@
+import os
+import struct
+import argparse
+
+# Packs shape data into the binary bank image read by BankRegistry
+# (include/bank_registry.h):
+#
+#   Header:  uint32 magic 'TRBK', uint16 version, uint16 entry count
+#   Entry[]: uint16 type, uint16 flags, uint32 offset, uint32 bytes,
+#            uint32 count
+#
+# Inputs are raw little-endian files:
+#   --stereo FILE        2048 int16: 1024 left then 1024 right samples
+#                        (type 0)
+#   --delta FILE COUNT   delta-encoded mesh stream with COUNT points,
+#                        as emitted by mesh_prep.py --delta (type 1)
+#
+# Flash the image into the reserved region with:
+#   picotool load bank.bin -t bin -o 0x10180000
+
+MAGIC = 0x4B425254
+VERSION = 1
+
+HEADER_FMT = "<IHH"
+ENTRY_FMT = "<HHIII"
+
+TYPE_STEREO = 0
+TYPE_DELTA = 1
+
+
+def pack(entries):
+    """entries: list of (type, payload bytes, count)"""
+    header_size = struct.calcsize(HEADER_FMT)
+    table_size = struct.calcsize(ENTRY_FMT) * len(entries)
+    offset = header_size + table_size
+    # keep payloads word-aligned for the DMA copy
+    offset = (offset + 3) & ~3
+
+    table = b""
+    payload = b""
+    for etype, data, count in entries:
+        table += struct.pack(ENTRY_FMT, etype, 0, offset, len(data), count)
+        payload += data
+        pad = (-len(data)) % 4
+        payload += b"\0" * pad
+        offset += len(data) + pad
+
+    image = struct.pack(HEADER_FMT, MAGIC, VERSION, len(entries))
+    image += table
+    image += b"\0" * ((-len(image)) % 4)
+    return image + payload
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description='Pack shape data into a flash bank image for BankRegistry'
+    )
+    parser.add_argument('--stereo', action='append', default=[], metavar='FILE',
+                        help='raw stereo wavetable: 2048 LE int16 (1024 L, 1024 R)')
+    parser.add_argument('--delta', action='append', nargs=2, default=[],
+                        metavar=('FILE', 'COUNT'),
+                        help='delta-encoded mesh stream and its point count')
+    parser.add_argument('-o', '--output', default='bank.bin',
+                        help='Output image path (default: bank.bin)')
+
+    args = parser.parse_args()
+
+    entries = []
+    for path in args.stereo:
+        data = open(path, 'rb').read()
+        if len(data) != 2048 * 2:
+            raise SystemExit(f"{path}: expected 4096 bytes, got {len(data)}")
+        entries.append((TYPE_STEREO, data, 0))
+    for path, count in args.delta:
+        entries.append((TYPE_DELTA, open(path, 'rb').read(), int(count)))
+
+    if not entries:
+        raise SystemExit("nothing to pack; give --stereo and/or --delta")
+
+    image = pack(entries)
+    with open(args.output, 'wb') as f:
+        f.write(image)
+
+    print(f"--- Packed {len(entries)} entries, {len(image)} bytes ---")
+    print(f"Image saved to: {args.output}")
+    print(f"Flash with: picotool load {args.output} -t bin -o 0x10180000")
@@ -93,6 +93,56 @@ def find_optimized_path(vertices, edges):
                 
     return path
 
+def delta_encode(vertices, path):
+    """Delta-encodes the path: one signed byte per axis per point,
+    0x80 escaping to an absolute little-endian int16 for jumps beyond
+    +-127. The first point is three escaped absolutes."""
+    out = []
+    prev = (0, 0, 0)
+    for idx in path:
+        p = vertices[idx]
+        for axis in range(3):
+            d = p[axis] - prev[axis]
+            if -127 <= d <= 127:
+                out.append(d & 0xFF)
+            else:
+                out.append(0x80)
+                out.append(p[axis] & 0xFF)
+                out.append((p[axis] >> 8) & 0xFF)
+        prev = p
+    return out
+
+
+def generate_delta_header(filename, vertices, path):
+    """Generates a C++ header with the delta-encoded path
+    (DeltaMeshPath format, see include/mesh_data.h)."""
+    base_name = os.path.splitext(os.path.basename(filename))[0].upper()
+    data = delta_encode(vertices, path)
+
+    header = [
+        f"#ifndef {base_name}_MESH_H",
+        f"#define {base_name}_MESH_H",
+        "",
+        '#include "mesh_data.h"',
+        "",
+        f"// {len(path)} points in {len(data)} bytes"
+        f" ({len(data) / len(path):.2f} bytes/point, expanded form is 6)",
+        f"constexpr uint8_t {base_name}_DELTA_DATA[{len(data)}] = {{",
+    ]
+
+    for i in range(0, len(data), 16):
+        header.append("    " + ", ".join(str(b) for b in data[i:i + 16]) + ",")
+
+    header.append("};")
+    header.append("")
+    header.append(f"constexpr DeltaMeshPath {base_name}_DELTA_PATH = "
+                  f"{{{base_name}_DELTA_DATA, {len(path)}}};")
+    header.append("")
+    header.append("#endif")
+
+    return "\n".join(header)
+
+
 def generate_header(filename, vertices, path):
     """Generates a C++ header file with the point data."""
     base_name = os.path.splitext(os.path.basename(filename))[0].upper()
@@ -126,9 +176,11 @@ if __name__ == "__main__":
         description='Convert OBJ 3D model to optimized C++ header with edge path'
     )
     parser.add_argument('input', help='Input OBJ file path')
-    parser.add_argument('-o', '--output', 
+    parser.add_argument('-o', '--output',
                         help='Output header file path (default: ../data/mesh_data.h)')
-    
+    parser.add_argument('--delta', action='store_true',
+                        help='Emit delta-encoded DeltaMeshPath instead of expanded Point3D array')
+
     args = parser.parse_args()
     
     # Set default output path if not provided
@@ -139,7 +191,10 @@ if __name__ == "__main__":
         v_data, e_data = parse_obj(args.input)
         final_path = find_optimized_path(v_data, e_data)
         
-        header_content = generate_header(args.input, v_data, final_path)
+        if args.delta:
+            header_content = generate_delta_header(args.input, v_data, final_path)
+        else:
+            header_content = generate_header(args.input, v_data, final_path)
         
         with open(args.output, "w") as f:
             f.write(header_content)
@@ -0,0 +1,38 @@
+import sys
+import struct
+import argparse
+
+# Sends a bank image (bank_pack.py output) to a card built with
+# -DTRACE_USB_UPLOAD over its USB serial port. Audio keeps running
+# while the image streams; the card pauses it only for the flash write
+# and answers 'K' on success.
+#
+# Requires pyserial:  pip install pyserial
+
+try:
+    import serial
+except ImportError:
+    print("pyserial required: pip install pyserial", file=sys.stderr)
+    sys.exit(1)
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description='Upload a bank image to the card over USB serial'
+    )
+    parser.add_argument('image', help='bank image file (bank_pack.py output)')
+    parser.add_argument('port', help='serial port, e.g. /dev/ttyACM0 or COM5')
+
+    args = parser.parse_args()
+
+    data = open(args.image, 'rb').read()
+
+    with serial.Serial(args.port, 115200, timeout=10) as s:
+        s.write(b"TRUP" + struct.pack("<BI", 0, len(data)))
+        s.write(data)
+        reply = s.read(1)
+
+    if reply == b'K':
+        print(f"--- Uploaded {len(data)} bytes, card confirmed ---")
+    else:
+        print(f"Upload failed (reply: {reply!r})", file=sys.stderr)
+        sys.exit(1)
@@ -143,7 +143,46 @@ def format_stereo_array_for_cpp(left_array, right_array, values_per_line=8):
     return '\n'.join(lines)
 
 
-def wav_to_wavetable(input_file, table_name="WAVETABLE", output_file=None):
+def band_limit_resample(audio_data, target_samples):
+    """
+    Band-limit a single-cycle wave to the harmonics representable at
+    target_samples, then resample. Used to build wavetable mip levels:
+    each level keeps only harmonics below the new Nyquist, so the
+    firmware can switch level with pitch instead of aliasing.
+    """
+    spectrum = np.fft.rfft(audio_data)
+    max_harmonic = target_samples // 2
+    spectrum[max_harmonic:] = 0
+    cleaned = np.fft.irfft(spectrum, len(audio_data))
+    return signal.resample(cleaned, target_samples)
+
+
+def build_mip_channel(audio_data, levels=4):
+    """
+    Build the packed mip pyramid for one channel: level 0 is the full
+    1024-sample table, each further level is band-limited to half the
+    harmonics and half the length (1024/512/256/128 = 1920 samples,
+    matching StereoTableMip in include/table_ram.h).
+    """
+    out = []
+    for lvl in range(levels):
+        out.append(band_limit_resample(audio_data, 1024 >> lvl))
+    return np.concatenate(out)
+
+
+def format_flat_array_for_cpp(array, values_per_line=8):
+    """Format a numpy int16 array as a brace-wrapped C++ initializer."""
+    lines = ["{"]
+    for i in range(0, len(array), values_per_line):
+        chunk = array[i:i + values_per_line]
+        values = ', '.join(f'{v:6d}' for v in chunk)
+        sep = ',' if i + values_per_line < len(array) else ''
+        lines.append(f"    {values}{sep}")
+    lines.append("}")
+    return '\n'.join(lines)
+
+
+def wav_to_wavetable(input_file, table_name="WAVETABLE", output_file=None, mips=False):
     """
     Convert WAV file to C++ wavetable header.
     
@@ -184,7 +223,21 @@ def wav_to_wavetable(input_file, table_name="WAVETABLE", output_file=None):
     
     output_lines.append("};")
     output_lines.append("")
-    
+
+    if mips:
+        # Pre-band-limited mip pyramid (1024/512/256/128 per channel).
+        # The firmware derives these at boot when absent; offline
+        # generation gives cleaner band-limiting (FFT truncation).
+        left_mip = normalize_to_int16(build_mip_channel(left_resampled))
+        right_mip = normalize_to_int16(build_mip_channel(right_resampled))
+        output_lines.append(f"// Mip pyramid, layout matches StereoTableMip (see include/table_ram.h)")
+        output_lines.append(f"inline constexpr int16_t {table_name}_MIP_LEFT[1920] = " +
+                            format_flat_array_for_cpp(left_mip) + ";")
+        output_lines.append("")
+        output_lines.append(f"inline constexpr int16_t {table_name}_MIP_RIGHT[1920] = " +
+                            format_flat_array_for_cpp(right_mip) + ";")
+        output_lines.append("")
+
     result = '\n'.join(output_lines)
     
     # Output
@@ -207,6 +260,8 @@ def main():
     parser.add_argument('input', help='Input WAV file path')
     parser.add_argument('-o', '--output', 
                         help='Output header file path (default: ../data/<input_name>_table.h)')
+    parser.add_argument('--mips', action='store_true',
+                        help='Also emit pre-band-limited mip levels (1024/512/256/128)')
     
     args = parser.parse_args()
     
@@ -218,7 +273,7 @@ def main():
         args.output = os.path.join(os.path.dirname(__file__), '..', 'data', output_filename)
     
     try:
-        wav_to_wavetable(args.input, 'WAVETABLE', args.output)
+        wav_to_wavetable(args.input, 'WAVETABLE', args.output, mips=args.mips)
     except FileNotFoundError:
         print(f"Error: File '{args.input}' not found.", file=sys.stderr)
         sys.exit(1)